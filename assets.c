@@ -0,0 +1,216 @@
+#include "assets.h"
+#include <stdio.h>
+#include <string.h>
+
+static int AssetWorker(void* arg) {
+    AssetManager* manager = arg;
+    char fullPath[ASSET_PATH_MAX * 2];
+
+    LockMutex(&manager->mutex);
+    for (;;) {
+        while (manager->queueCount == 0 && !manager->quit) WaitCondition(&manager->wake, &manager->mutex);
+        if (manager->quit) break;
+
+        int handle = manager->queue[manager->queueHead];
+        manager->queueHead = (manager->queueHead + 1) % MAX_ASSETS;
+        manager->queueCount--;
+        ResolveAssetPath(manager, manager->assets[handle].path, fullPath, sizeof(fullPath));
+        UnlockMutex(&manager->mutex);
+
+        // Decode kilit dışında; slot QUEUED iken ana iş parçacığı ona dokunmaz
+        Image image = LoadImage(fullPath);
+
+        LockMutex(&manager->mutex);
+        manager->assets[handle].image = image;
+        manager->assets[handle].state = (image.data != NULL) ? ASSET_DECODED : ASSET_FAILED;
+        manager->pendingCount--;
+    }
+    UnlockMutex(&manager->mutex);
+    return 0;
+}
+
+bool InitAssetManager(AssetManager* manager, const char* root, int workerCount) {
+    memset(manager, 0, sizeof(*manager));
+    snprintf(manager->root, sizeof(manager->root), "%s", root != NULL ? root : "");
+    if (!InitMutex(&manager->mutex)) return false;
+    if (!InitCondition(&manager->wake)) {
+        DestroyMutex(&manager->mutex);
+        return false;
+    }
+
+    if (workerCount <= 0) workerCount = GetCpuCount() - 1;
+    if (workerCount < 1) workerCount = 1;
+    if (workerCount > ASSET_MAX_WORKERS) workerCount = ASSET_MAX_WORKERS;
+    for (int i = 0; i < workerCount; i++) {
+        if (!StartThread(&manager->workers[manager->workerCount], AssetWorker, manager)) break;
+        manager->workerCount++;
+    }
+    if (manager->workerCount == 0) {
+        DestroyCondition(&manager->wake);
+        DestroyMutex(&manager->mutex);
+        return false;
+    }
+    return true;
+}
+
+void CloseAssetManager(AssetManager* manager) {
+    LockMutex(&manager->mutex);
+    manager->quit = true;
+    BroadcastCondition(&manager->wake);
+    UnlockMutex(&manager->mutex);
+    for (int i = 0; i < manager->workerCount; i++) JoinThread(&manager->workers[i]);
+
+    for (int i = 0; i < MAX_ASSETS; i++) {
+        Asset* asset = &manager->assets[i];
+        if (asset->image.data != NULL) UnloadImage(asset->image);
+        if (asset->texture.id != 0) UnloadTexture(asset->texture);
+    }
+    DestroyCondition(&manager->wake);
+    DestroyMutex(&manager->mutex);
+    manager->workerCount = 0;
+}
+
+const char* JoinAssetPath(const char* root, const char* path, char* out, int outSize) {
+    size_t rootLength = strlen(root);
+    bool hasSeparator = rootLength == 0 || root[rootLength - 1] == '/' || root[rootLength - 1] == '\\';
+    snprintf(out, outSize, "%s%s%s", root, hasSeparator ? "" : "/", path);
+    return out;
+}
+
+const char* ResolveAssetPath(const AssetManager* manager, const char* path, char* out, int outSize) {
+    return JoinAssetPath(manager->root, path, out, outSize);
+}
+
+static AssetHandle RequestAsset(AssetManager* manager, const char* path, AssetKind kind) {
+    AssetHandle handle = -1;
+
+    LockMutex(&manager->mutex);
+    for (int i = 0; i < MAX_ASSETS; i++) {
+        Asset* asset = &manager->assets[i];
+        if (asset->state != ASSET_EMPTY && asset->kind == kind && strcmp(asset->path, path) == 0) {
+            asset->refCount++;
+            handle = i;
+            break;
+        }
+    }
+    if (handle == -1) {
+        for (int i = 0; i < MAX_ASSETS; i++) {
+            if (manager->assets[i].state != ASSET_EMPTY) continue;
+            Asset* asset = &manager->assets[i];
+            memset(asset, 0, sizeof(*asset));
+            snprintf(asset->path, sizeof(asset->path), "%s", path);
+            asset->kind = kind;
+            asset->state = ASSET_QUEUED;
+            asset->refCount = 1;
+            manager->queue[(manager->queueHead + manager->queueCount) % MAX_ASSETS] = i;
+            manager->queueCount++;
+            manager->pendingCount++;
+            SignalCondition(&manager->wake);
+            handle = i;
+            break;
+        }
+    }
+    UnlockMutex(&manager->mutex);
+    return handle;
+}
+
+AssetHandle RequestTexture(AssetManager* manager, const char* path) {
+    return RequestAsset(manager, path, ASSET_TEXTURE);
+}
+
+AssetHandle RequestImage(AssetManager* manager, const char* path) {
+    return RequestAsset(manager, path, ASSET_IMAGE);
+}
+
+// Kilit alınmış olmalı; yalnızca decode'u bitmiş varlıklar boşaltılabilir
+static void FreeAsset(Asset* asset) {
+    if (asset->image.data != NULL) UnloadImage(asset->image);
+    if (asset->texture.id != 0) UnloadTexture(asset->texture);
+    memset(asset, 0, sizeof(*asset));
+}
+
+void ReleaseAsset(AssetManager* manager, AssetHandle handle) {
+    if (handle < 0 || handle >= MAX_ASSETS) return;
+    LockMutex(&manager->mutex);
+    Asset* asset = &manager->assets[handle];
+    if (asset->refCount > 0) asset->refCount--;
+    // Decode sürüyorsa slot PumpAssets'te serbest bırakılır
+    if (asset->refCount == 0 && asset->state != ASSET_QUEUED && asset->state != ASSET_EMPTY) FreeAsset(asset);
+    UnlockMutex(&manager->mutex);
+}
+
+int PumpAssets(AssetManager* manager, int maxUploads) {
+    int uploads[MAX_ASSETS];
+    int uploadCount = 0;
+
+    LockMutex(&manager->mutex);
+    for (int i = 0; i < MAX_ASSETS; i++) {
+        Asset* asset = &manager->assets[i];
+        if (asset->state != ASSET_DECODED) continue;
+        if (asset->refCount == 0) {
+            FreeAsset(asset);
+        }
+        else if (asset->kind == ASSET_IMAGE) {
+            asset->state = ASSET_READY;
+        }
+        else if (uploadCount < maxUploads) {
+            uploads[uploadCount++] = i;
+        }
+    }
+    UnlockMutex(&manager->mutex);
+
+    // DECODED slotlara iş parçacıkları yazmaz; GPU yüklemesi kilitsiz yapılabilir
+    for (int k = 0; k < uploadCount; k++) {
+        Asset* asset = &manager->assets[uploads[k]];
+        asset->texture = LoadTextureFromImage(asset->image);
+        UnloadImage(asset->image);
+        asset->image = (Image){ 0 };
+        LockMutex(&manager->mutex);
+        asset->state = (asset->texture.id != 0) ? ASSET_READY : ASSET_FAILED;
+        UnlockMutex(&manager->mutex);
+    }
+
+    LockMutex(&manager->mutex);
+    int pending = manager->pendingCount;
+    for (int i = 0; i < MAX_ASSETS; i++) {
+        if (manager->assets[i].state == ASSET_DECODED) pending++;
+    }
+    UnlockMutex(&manager->mutex);
+    return pending;
+}
+
+bool IsAssetReady(AssetManager* manager, AssetHandle handle) {
+    if (handle < 0 || handle >= MAX_ASSETS) return false;
+    LockMutex(&manager->mutex);
+    bool ready = manager->assets[handle].state == ASSET_READY;
+    UnlockMutex(&manager->mutex);
+    return ready;
+}
+
+Texture2D GetAssetTexture(AssetManager* manager, AssetHandle handle) {
+    if (!IsAssetReady(manager, handle)) return (Texture2D){ 0 };
+    return manager->assets[handle].texture;
+}
+
+Image GetAssetImage(AssetManager* manager, AssetHandle handle) {
+    if (!IsAssetReady(manager, handle)) return (Image){ 0 };
+    return manager->assets[handle].image;
+}
+
+const char* ResolveMusicPath(const AssetManager* manager, const char* path, char* out, int outSize) {
+    // Sıkıştırılmış biçimler diskte ve bellekte çok daha küçük
+    static const char* compressed[] = { ".qoa", ".ogg" };
+    const char* dot = strrchr(path, '.');
+    int stemLength = (dot != NULL) ? (int)(dot - path) : (int)strlen(path);
+    for (int i = 0; i < (int)(sizeof(compressed) / sizeof(compressed[0])); i++) {
+        char sibling[ASSET_PATH_MAX];
+        snprintf(sibling, sizeof(sibling), "%.*s%s", stemLength, path, compressed[i]);
+        if (FileExists(ResolveAssetPath(manager, sibling, out, outSize))) return out;
+    }
+    return ResolveAssetPath(manager, path, out, outSize);
+}
+
+Music LoadMusicAsset(const AssetManager* manager, const char* path) {
+    char fullPath[ASSET_PATH_MAX * 2];
+    return LoadMusicStream(ResolveMusicPath(manager, path, fullPath, sizeof(fullPath)));
+}
@@ -0,0 +1,81 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+// Kaynak yöneticisi: yollar ayarlanabilir bir kök dizine göre çözülür,
+// görüntüler iş parçacığı havuzunda decode edilir, GPU'ya yükleme ana
+// iş parçacığında PumpAssets ile yapılır. Aynı yol ve tür için yapılan
+// istekler aynı handle'ı paylaşır (referans sayımlı).
+
+#include "raylib.h"
+#include "thread.h"
+
+#define MAX_ASSETS 64
+#define ASSET_PATH_MAX 260
+#define ASSET_MAX_WORKERS 4
+
+typedef int AssetHandle; // Geçersizse -1
+
+typedef enum AssetKind {
+    ASSET_TEXTURE, // Decode edilir, GPU'ya yüklenir, CPU kopyası bırakılır
+    ASSET_IMAGE    // Yalnızca decode edilir (ör. atlas paketleme için)
+} AssetKind;
+
+typedef enum AssetState {
+    ASSET_EMPTY,
+    ASSET_QUEUED,
+    ASSET_DECODED,
+    ASSET_READY,
+    ASSET_FAILED
+} AssetState;
+
+typedef struct {
+    char path[ASSET_PATH_MAX]; // Köke göre göreli
+    AssetKind kind;
+    AssetState state;
+    int refCount;
+    Image image;
+    Texture2D texture;
+} Asset;
+
+typedef struct {
+    char root[ASSET_PATH_MAX];
+    Asset assets[MAX_ASSETS];
+    int queue[MAX_ASSETS]; // Decode bekleyen handle'lar (halka)
+    int queueHead;
+    int queueCount;
+    int pendingCount;      // Kuyrukta veya decode edilmekte olanlar
+    bool quit;
+    Mutex mutex;
+    Condition wake;
+    Thread workers[ASSET_MAX_WORKERS];
+    int workerCount;
+} AssetManager;
+
+// workerCount <= 0 ise çekirdek sayısına göre seçilir.
+bool InitAssetManager(AssetManager* manager, const char* root, int workerCount);
+void CloseAssetManager(AssetManager* manager);
+
+// Köke göre göreli yolu tam yola çevirir.
+const char* JoinAssetPath(const char* root, const char* path, char* out, int outSize);
+const char* ResolveAssetPath(const AssetManager* manager, const char* path, char* out, int outSize);
+
+AssetHandle RequestTexture(AssetManager* manager, const char* path);
+AssetHandle RequestImage(AssetManager* manager, const char* path);
+void ReleaseAsset(AssetManager* manager, AssetHandle handle);
+
+// Ana iş parçacığında her karede çağrılır; en fazla maxUploads dokuyu
+// GPU'ya yükler. Hâlâ bekleyen varlık sayısını döner.
+int PumpAssets(AssetManager* manager, int maxUploads);
+
+bool IsAssetReady(AssetManager* manager, AssetHandle handle);
+// Hazır değilse boş (id 0) doku/görüntü döner.
+Texture2D GetAssetTexture(AssetManager* manager, AssetHandle handle);
+Image GetAssetImage(AssetManager* manager, AssetHandle handle);
+
+// Aynı adlı .qoa veya .ogg dosyası varsa onu, yoksa verilen yolu çözer.
+const char* ResolveMusicPath(const AssetManager* manager, const char* path, char* out, int outSize);
+// Müzik akışları zaten parça parça decode edilir; yalnızca yol çözülür
+// (ResolveMusicPath).
+Music LoadMusicAsset(const AssetManager* manager, const char* path);
+
+#endif
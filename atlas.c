@@ -0,0 +1,59 @@
+#include "atlas.h"
+#include <string.h>
+
+#define ATLAS_MAX_WIDTH 2048
+
+// Raf (shelf) paketleme: sprite'lar yüksekliğe göre sıralanıp satır satır yerleştirilir
+bool BuildSpriteAtlas(SpriteAtlas* atlas, const Image images[SPRITE_COUNT]) {
+    memset(atlas, 0, sizeof(*atlas));
+
+    int order[SPRITE_COUNT];
+    int orderCount = 0;
+    for (int id = 0; id < SPRITE_COUNT; id++) {
+        if (images[id].data != NULL) order[orderCount++] = id;
+    }
+    for (int i = 1; i < orderCount; i++) {
+        int id = order[i];
+        int j = i - 1;
+        while (j >= 0 && images[order[j]].height < images[id].height) {
+            order[j + 1] = order[j];
+            j--;
+        }
+        order[j + 1] = id;
+    }
+
+    int x = ATLAS_PADDING, y = ATLAS_PADDING, shelfHeight = 0, width = 0;
+    for (int i = 0; i < orderCount; i++) {
+        const Image* image = &images[order[i]];
+        if (x + image->width + ATLAS_PADDING > ATLAS_MAX_WIDTH && x > ATLAS_PADDING) {
+            x = ATLAS_PADDING;
+            y += shelfHeight + ATLAS_PADDING;
+            shelfHeight = 0;
+        }
+        atlas->regions[order[i]] = (Rectangle){ (float)x, (float)y, (float)image->width, (float)image->height };
+        x += image->width + ATLAS_PADDING;
+        if (x > width) width = x;
+        if (image->height > shelfHeight) shelfHeight = image->height;
+    }
+    int height = y + shelfHeight + ATLAS_PADDING;
+
+    bool ok = false;
+    if (orderCount > 0) {
+        // ImageDraw farklı piksel formatlarını kendisi dönüştürür
+        Image sheet = GenImageColor(width, height, BLANK);
+        for (int i = 0; i < orderCount; i++) {
+            const Image* image = &images[order[i]];
+            Rectangle src = { 0, 0, (float)image->width, (float)image->height };
+            ImageDraw(&sheet, *image, src, atlas->regions[order[i]], WHITE);
+        }
+        atlas->texture = LoadTextureFromImage(sheet);
+        UnloadImage(sheet);
+        ok = atlas->texture.id != 0;
+    }
+    return ok;
+}
+
+void UnloadSpriteAtlas(SpriteAtlas* atlas) {
+    if (atlas->texture.id != 0) UnloadTexture(atlas->texture);
+    memset(atlas, 0, sizeof(*atlas));
+}
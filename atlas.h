@@ -0,0 +1,22 @@
+#ifndef ATLAS_H
+#define ATLAS_H
+
+// Dünya sprite'ları yükleme sırasında tek bir dokuya paketlenir; böylece
+// tüm parkur tek doku ile (raylib'in iç batch'inde tek draw call) çizilir.
+
+#include "raylib.h"
+#include "entities.h"
+
+#define ATLAS_PADDING 2 // Filtrelemede komşu bölgelerin taşmaması için
+
+typedef struct {
+    Texture2D texture;
+    Rectangle regions[SPRITE_COUNT]; // Piksel cinsinden, yüklenmeyenler 0 boyutlu
+} SpriteAtlas;
+
+// Decode edilmiş görüntülerden atlas kurar; data'sı NULL olanlar atlanır.
+// Görüntülerin sahipliği çağıranda kalır.
+bool BuildSpriteAtlas(SpriteAtlas* atlas, const Image images[SPRITE_COUNT]);
+void UnloadSpriteAtlas(SpriteAtlas* atlas);
+
+#endif
@@ -0,0 +1,221 @@
+#include "audio.h"
+#include "profiler.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static bool IsValidTrack(const AudioMixer* mixer, AudioTrackId id) {
+    return id >= 0 && id < AUDIO_MAX_TRACKS && mixer->tracks[id].loaded;
+}
+
+static void ApplyVolume(const AudioMixer* mixer) {
+    if (mixer->backend == AUDIO_BACKEND_RAYLIB) SetMasterVolume(mixer->muted ? 0.0f : mixer->volume);
+}
+
+// Çalan akışların tamponlarını doldurur; null arka uçta yalnızca konum ilerler
+static void RefillTracks(AudioMixer* mixer, uint64_t now) {
+    double elapsed = (double)(now - mixer->lastRefillNs) / 1e9;
+    for (int id = 0; id < AUDIO_MAX_TRACKS; id++) {
+        AudioTrack* track = &mixer->tracks[id];
+        if (!track->loaded || !track->playing || track->paused) continue;
+        if (mixer->backend == AUDIO_BACKEND_RAYLIB) {
+            UpdateMusicStream(track->music);
+            track->position = GetMusicTimePlayed(track->music);
+        }
+        else if (track->length > 0.0) {
+            // raylib akışları varsayılan olarak döngüde çalar; konum başa sarar
+            track->position = fmod(track->position + elapsed, track->length);
+        }
+    }
+
+    uint64_t gap = now - mixer->lastRefillNs;
+    if (mixer->stats.refillCount > 0 && gap > mixer->stats.maxRefillGapNs) mixer->stats.maxRefillGapNs = gap;
+    mixer->stats.refillCount++;
+    mixer->lastRefillNs = now;
+}
+
+static int AudioThread(void* arg) {
+    AudioMixer* mixer = arg;
+    for (;;) {
+        LockMutex(&mixer->mutex);
+        if (mixer->quit) {
+            UnlockMutex(&mixer->mutex);
+            break;
+        }
+        PROFILE_BEGIN(PROFILE_MUSIC);
+        RefillTracks(mixer, GetMonotonicNs());
+        PROFILE_END(PROFILE_MUSIC);
+        UnlockMutex(&mixer->mutex);
+        SleepMilliseconds(AUDIO_REFILL_MS);
+    }
+    return 0;
+}
+
+bool InitAudioMixer(AudioMixer* mixer, AudioBackend backend) {
+    memset(mixer, 0, sizeof(*mixer));
+    mixer->volume = 1.0f;
+
+    const char* forced = getenv("ALGOLAB_AUDIO");
+    if (forced != NULL && strcmp(forced, "null") == 0) backend = AUDIO_BACKEND_NULL;
+    if (backend == AUDIO_BACKEND_RAYLIB) {
+        InitAudioDevice();
+        if (!IsAudioDeviceReady()) {
+            TraceLog(LOG_WARNING, "AUDIO: ses aygiti acilamadi, null arka uc kullaniliyor");
+            backend = AUDIO_BACKEND_NULL;
+        }
+    }
+    mixer->backend = backend;
+    ApplyVolume(mixer);
+
+    if (!InitMutex(&mixer->mutex)) {
+        if (backend == AUDIO_BACKEND_RAYLIB) CloseAudioDevice();
+        return false;
+    }
+    mixer->lastRefillNs = GetMonotonicNs();
+    if (!StartThread(&mixer->thread, AudioThread, mixer)) {
+        DestroyMutex(&mixer->mutex);
+        if (backend == AUDIO_BACKEND_RAYLIB) CloseAudioDevice();
+        return false;
+    }
+    return true;
+}
+
+void CloseAudioMixer(AudioMixer* mixer) {
+    LockMutex(&mixer->mutex);
+    mixer->quit = true;
+    UnlockMutex(&mixer->mutex);
+    JoinThread(&mixer->thread);
+    DestroyMutex(&mixer->mutex);
+
+    for (int id = 0; id < AUDIO_MAX_TRACKS; id++) {
+        AudioTrack* track = &mixer->tracks[id];
+        if (track->loaded && mixer->backend == AUDIO_BACKEND_RAYLIB) UnloadMusicStream(track->music);
+    }
+    memset(mixer->tracks, 0, sizeof(mixer->tracks));
+    if (mixer->backend == AUDIO_BACKEND_RAYLIB) CloseAudioDevice();
+}
+
+AudioTrackId LoadAudioTrack(AudioMixer* mixer, const AssetManager* assets, const char* path) {
+    // Yükleme (dosya açma, başlık okuma) kilit dışında yapılır
+    Music music = { 0 };
+    double length;
+    if (mixer->backend == AUDIO_BACKEND_RAYLIB) {
+        music = LoadMusicAsset(assets, path);
+        if (music.stream.buffer == NULL) return -1;
+        length = GetMusicTimeLength(music);
+    }
+    else {
+        // Aygıt olmadan akış açılamaz; süre için dosya bir kez decode edilir
+        char fullPath[ASSET_PATH_MAX * 2];
+        Wave wave = LoadWave(ResolveMusicPath(assets, path, fullPath, sizeof(fullPath)));
+        if (wave.data == NULL || wave.sampleRate == 0) {
+            UnloadWave(wave);
+            return -1;
+        }
+        length = (double)wave.frameCount / wave.sampleRate;
+        UnloadWave(wave);
+    }
+
+    LockMutex(&mixer->mutex);
+    AudioTrackId result = -1;
+    for (int id = 0; id < AUDIO_MAX_TRACKS; id++) {
+        if (mixer->tracks[id].loaded) continue;
+        mixer->tracks[id] = (AudioTrack){ .music = music, .loaded = true, .length = length };
+        result = id;
+        break;
+    }
+    UnlockMutex(&mixer->mutex);
+
+    if (result == -1 && mixer->backend == AUDIO_BACKEND_RAYLIB) UnloadMusicStream(music);
+    return result;
+}
+
+void PlayAudioTrack(AudioMixer* mixer, AudioTrackId id) {
+    LockMutex(&mixer->mutex);
+    if (IsValidTrack(mixer, id)) {
+        AudioTrack* track = &mixer->tracks[id];
+        if (mixer->backend == AUDIO_BACKEND_RAYLIB) PlayMusicStream(track->music);
+        track->playing = true;
+        track->paused = false;
+    }
+    UnlockMutex(&mixer->mutex);
+}
+
+void StopAudioTrack(AudioMixer* mixer, AudioTrackId id) {
+    LockMutex(&mixer->mutex);
+    if (IsValidTrack(mixer, id)) {
+        AudioTrack* track = &mixer->tracks[id];
+        if (mixer->backend == AUDIO_BACKEND_RAYLIB) StopMusicStream(track->music);
+        track->playing = false;
+        track->paused = false;
+        track->position = 0.0;
+    }
+    UnlockMutex(&mixer->mutex);
+}
+
+void PauseAudioTrack(AudioMixer* mixer, AudioTrackId id) {
+    LockMutex(&mixer->mutex);
+    if (IsValidTrack(mixer, id) && mixer->tracks[id].playing) {
+        AudioTrack* track = &mixer->tracks[id];
+        if (mixer->backend == AUDIO_BACKEND_RAYLIB) PauseMusicStream(track->music);
+        track->paused = true;
+    }
+    UnlockMutex(&mixer->mutex);
+}
+
+void ResumeAudioTrack(AudioMixer* mixer, AudioTrackId id) {
+    LockMutex(&mixer->mutex);
+    if (IsValidTrack(mixer, id) && mixer->tracks[id].paused) {
+        AudioTrack* track = &mixer->tracks[id];
+        if (mixer->backend == AUDIO_BACKEND_RAYLIB) ResumeMusicStream(track->music);
+        track->paused = false;
+    }
+    UnlockMutex(&mixer->mutex);
+}
+
+void SeekAudioTrack(AudioMixer* mixer, AudioTrackId id, double seconds) {
+    LockMutex(&mixer->mutex);
+    if (IsValidTrack(mixer, id)) {
+        AudioTrack* track = &mixer->tracks[id];
+        if (!(seconds > 0.0)) seconds = 0.0;
+        if (track->length > 0.0 && seconds >= track->length) seconds = fmod(seconds, track->length);
+        if (mixer->backend == AUDIO_BACKEND_RAYLIB) SeekMusicStream(track->music, (float)seconds);
+        track->position = seconds;
+    }
+    UnlockMutex(&mixer->mutex);
+}
+
+bool IsAudioTrackPlaying(AudioMixer* mixer, AudioTrackId id) {
+    LockMutex(&mixer->mutex);
+    bool playing = IsValidTrack(mixer, id) && mixer->tracks[id].playing && !mixer->tracks[id].paused;
+    UnlockMutex(&mixer->mutex);
+    return playing;
+}
+
+double GetAudioTrackPosition(AudioMixer* mixer, AudioTrackId id) {
+    LockMutex(&mixer->mutex);
+    double position = IsValidTrack(mixer, id) ? mixer->tracks[id].position : 0.0;
+    UnlockMutex(&mixer->mutex);
+    return position;
+}
+
+double GetAudioTrackLength(AudioMixer* mixer, AudioTrackId id) {
+    LockMutex(&mixer->mutex);
+    double length = IsValidTrack(mixer, id) ? mixer->tracks[id].length : 0.0;
+    UnlockMutex(&mixer->mutex);
+    return length;
+}
+
+void SetAudioMuted(AudioMixer* mixer, bool muted) {
+    LockMutex(&mixer->mutex);
+    mixer->muted = muted;
+    ApplyVolume(mixer);
+    UnlockMutex(&mixer->mutex);
+}
+
+AudioStats GetAudioStats(AudioMixer* mixer) {
+    LockMutex(&mixer->mutex);
+    AudioStats stats = mixer->stats;
+    UnlockMutex(&mixer->mutex);
+    return stats;
+}
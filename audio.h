@@ -0,0 +1,72 @@
+#ifndef AUDIO_H
+#define AUDIO_H
+
+// Müzik karıştırıcısı: akış tamponları ana döngüden bağımsız, kendi iş
+// parçacığında AUDIO_REFILL_MS aralıkla doldurulur. Böylece uzun bir kare
+// sesi kesmez, decode işi de kare bütçesine binmez. Parçalar yalnızca id
+// ile kullanılır; tüm çağrılar ve dolum döngüsü karıştırıcı kilidini alır.
+// Null arka uç ses aygıtı açmaz, çalmayı zamanla ilerleterek taklit eder
+// (ekransız test ve aygıtı olmayan makineler için); parça süresini dosyayı
+// yüklerken bir kez decode ederek bulur, konumu akışlar gibi döngüde sarar.
+
+#include "raylib.h"
+#include "assets.h"
+#include "thread.h"
+#include <stdint.h>
+
+#define AUDIO_MAX_TRACKS 8
+#define AUDIO_REFILL_MS 10
+
+typedef int AudioTrackId; // Geçersizse -1
+
+typedef enum AudioBackend {
+    AUDIO_BACKEND_RAYLIB,
+    AUDIO_BACKEND_NULL
+} AudioBackend;
+
+typedef struct {
+    Music music;     // Null arka uçta boş
+    bool loaded;
+    bool playing;
+    bool paused;
+    double position; // Çalınan süre (sn), null arka uçta taklit edilir
+    double length;   // Parça süresi (sn); döngüde konum [0, length) içinde kalır
+} AudioTrack;
+
+typedef struct {
+    uint64_t refillCount;
+    uint64_t maxRefillGapNs; // Ardışık iki dolum arasındaki en uzun süre
+} AudioStats;
+
+typedef struct {
+    AudioBackend backend;
+    AudioTrack tracks[AUDIO_MAX_TRACKS];
+    bool muted;
+    float volume;
+    AudioStats stats;
+    uint64_t lastRefillNs;
+    bool quit;
+    Mutex mutex;
+    Thread thread;
+} AudioMixer;
+
+// Aygıt açılamazsa veya ALGOLAB_AUDIO=null ise null arka uca düşer.
+bool InitAudioMixer(AudioMixer* mixer, AudioBackend backend);
+void CloseAudioMixer(AudioMixer* mixer);
+
+// Yol LoadMusicAsset ile çözülür (sıkıştırılmış kardeş dosya tercih edilir).
+AudioTrackId LoadAudioTrack(AudioMixer* mixer, const AssetManager* assets, const char* path);
+void PlayAudioTrack(AudioMixer* mixer, AudioTrackId id);
+void StopAudioTrack(AudioMixer* mixer, AudioTrackId id);
+void PauseAudioTrack(AudioMixer* mixer, AudioTrackId id);
+void ResumeAudioTrack(AudioMixer* mixer, AudioTrackId id);
+// seconds [0, length) aralığına getirilir; konum hemen güncellenir.
+void SeekAudioTrack(AudioMixer* mixer, AudioTrackId id, double seconds);
+bool IsAudioTrackPlaying(AudioMixer* mixer, AudioTrackId id);
+double GetAudioTrackPosition(AudioMixer* mixer, AudioTrackId id);
+double GetAudioTrackLength(AudioMixer* mixer, AudioTrackId id);
+
+void SetAudioMuted(AudioMixer* mixer, bool muted);
+AudioStats GetAudioStats(AudioMixer* mixer);
+
+#endif
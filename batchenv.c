@@ -0,0 +1,287 @@
+#include "batchenv.h"
+#include "replay.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define SLAB_ALIGN 64
+
+static size_t AlignUp(size_t n, size_t align) {
+    return (n + align - 1) & ~(align - 1);
+}
+
+// Ortam slab'ındaki dizilerin yerleşimi; tüm ortamlarda aynıdır
+typedef struct {
+    size_t enemyX, enemyDirection, enemyActive, enemyLastTick, enemyWakeTick, blockHit, coinCollected;
+    size_t wakeHeads, wakeNext, wakePrev, wakeTick, wakeScheduled, wakeDue;
+    size_t enemyHeads, enemyNext, enemyCellX, enemyCellY, enemyInserted;
+    size_t coinHeads, coinNext, coinCellX, coinCellY, coinInserted;
+    size_t total;
+} SlabLayout;
+
+static size_t Reserve(size_t* offset, size_t bytes) {
+    size_t start = *offset;
+    *offset = AlignUp(start + bytes, 16);
+    return start;
+}
+
+static SlabLayout GetSlabLayout(const World* level) {
+    const SpatialHash* enemyGrid = &level->enemyGrid;
+    const SpatialHash* coinGrid = &level->coinGrid;
+    int enemies = level->enemies.capacity > 0 ? level->enemies.capacity : 1;
+    SlabLayout layout;
+    size_t offset = 0;
+    layout.enemyX = Reserve(&offset, sizeof(float) * enemies);
+    layout.enemyDirection = Reserve(&offset, sizeof(int8_t) * enemies);
+    layout.enemyActive = Reserve(&offset, sizeof(uint32_t) * FLAG_WORDS(enemies));
+    layout.enemyLastTick = Reserve(&offset, sizeof(uint32_t) * enemies);
+    layout.enemyWakeTick = Reserve(&offset, sizeof(uint32_t) * enemies);
+    layout.blockHit = Reserve(&offset, sizeof(uint32_t) * FLAG_WORDS(level->blocks.capacity > 0 ? level->blocks.capacity : 1));
+    layout.coinCollected = Reserve(&offset, sizeof(uint32_t) * FLAG_WORDS(level->coins.capacity > 0 ? level->coins.capacity : 1));
+
+    int enemyItems = enemyGrid->capacity > 0 ? enemyGrid->capacity : 1;
+    layout.enemyHeads = Reserve(&offset, sizeof(int) * (enemyGrid->bucketMask + 1));
+    layout.enemyNext = Reserve(&offset, sizeof(int) * enemyItems);
+    layout.enemyCellX = Reserve(&offset, sizeof(int) * enemyItems);
+    layout.enemyCellY = Reserve(&offset, sizeof(int) * enemyItems);
+    layout.enemyInserted = Reserve(&offset, sizeof(bool) * enemyItems);
+
+    layout.wakeHeads = Reserve(&offset, sizeof(int) * WAKE_WHEEL_SLOTS);
+    layout.wakeNext = Reserve(&offset, sizeof(int) * enemies);
+    layout.wakePrev = Reserve(&offset, sizeof(int) * enemies);
+    layout.wakeTick = Reserve(&offset, sizeof(uint32_t) * enemies);
+    layout.wakeScheduled = Reserve(&offset, sizeof(bool) * enemies);
+    layout.wakeDue = Reserve(&offset, sizeof(int) * enemies);
+
+    int coinItems = coinGrid->capacity > 0 ? coinGrid->capacity : 1;
+    layout.coinHeads = Reserve(&offset, sizeof(int) * (coinGrid->bucketMask + 1));
+    layout.coinNext = Reserve(&offset, sizeof(int) * coinItems);
+    layout.coinCellX = Reserve(&offset, sizeof(int) * coinItems);
+    layout.coinCellY = Reserve(&offset, sizeof(int) * coinItems);
+    layout.coinInserted = Reserve(&offset, sizeof(bool) * coinItems);
+
+    // Komşu ortamlar aynı önbellek satırını paylaşmasın
+    layout.total = AlignUp(offset, SLAB_ALIGN);
+    return layout;
+}
+
+// Şablonun değişmeyen dizileri paylaşılır, değişenler ortamın slab payına bağlanır
+static void BindWorld(World* world, const World* level, uint8_t* base, const SlabLayout* layout) {
+    *world = *level;
+    world->jobs = NULL;
+    world->nav = NULL; // Akış alanı ortak olurdu; ortamlarda düşmanlar devriye gezer (y şablonla ortak)
+
+    world->enemies.x = (float*)(base + layout->enemyX);
+    world->enemies.direction = (int8_t*)(base + layout->enemyDirection);
+    world->enemies.active = (uint32_t*)(base + layout->enemyActive);
+    world->enemies.lastTick = (uint32_t*)(base + layout->enemyLastTick);
+    world->enemies.wakeTick = (uint32_t*)(base + layout->enemyWakeTick);
+    world->blocks.hit = (uint32_t*)(base + layout->blockHit);
+    world->blocks.changed = NULL; // Çizilmeyen ortamlar değişiklik kaydı ve olay tutmaz
+    world->events = (WorldEventLog){ 0 };
+    world->coins.collected = (uint32_t*)(base + layout->coinCollected);
+
+    world->enemyGrid.heads = (int*)(base + layout->enemyHeads);
+    world->enemyGrid.next = (int*)(base + layout->enemyNext);
+    world->enemyGrid.cellX = (int*)(base + layout->enemyCellX);
+    world->enemyGrid.cellY = (int*)(base + layout->enemyCellY);
+    world->enemyGrid.inserted = (bool*)(base + layout->enemyInserted);
+
+    // Takvim ilk tick'te slab'da wakeTick'ten kurulur
+    world->enemySchedule.wheel.heads = (int*)(base + layout->wakeHeads);
+    world->enemySchedule.wheel.next = (int*)(base + layout->wakeNext);
+    world->enemySchedule.wheel.prev = (int*)(base + layout->wakePrev);
+    world->enemySchedule.wheel.tick = (uint32_t*)(base + layout->wakeTick);
+    world->enemySchedule.wheel.scheduled = (bool*)(base + layout->wakeScheduled);
+    world->enemySchedule.due = (int*)(base + layout->wakeDue);
+    world->enemySchedule.stale = true;
+
+    world->coinGrid.heads = (int*)(base + layout->coinHeads);
+    world->coinGrid.next = (int*)(base + layout->coinNext);
+    world->coinGrid.cellX = (int*)(base + layout->coinCellX);
+    world->coinGrid.cellY = (int*)(base + layout->coinCellY);
+    world->coinGrid.inserted = (bool*)(base + layout->coinInserted);
+}
+
+static void CopyGrid(SpatialHash* to, const SpatialHash* from) {
+    int items = from->capacity > 0 ? from->capacity : 1;
+    memcpy(to->heads, from->heads, sizeof(int) * (from->bucketMask + 1));
+    memcpy(to->next, from->next, sizeof(int) * items);
+    memcpy(to->cellX, from->cellX, sizeof(int) * items);
+    memcpy(to->cellY, from->cellY, sizeof(int) * items);
+    memcpy(to->inserted, from->inserted, sizeof(bool) * items);
+}
+
+static void ResetWorld(World* world, const World* level) {
+    world->marioPosition = level->marioPosition;
+    world->velocityY = level->velocityY;
+    world->isJumping = level->isJumping;
+    world->isMoving = level->isMoving;
+    world->marioDirection = level->marioDirection;
+    world->walkFrame = level->walkFrame;
+    world->walkFrameCounter = level->walkFrameCounter;
+    world->score = level->score;
+    world->tick = level->tick;
+
+    int enemies = level->enemies.count;
+    memcpy(world->enemies.x, level->enemies.x, sizeof(float) * enemies);
+    memcpy(world->enemies.direction, level->enemies.direction, sizeof(int8_t) * enemies);
+    memcpy(world->enemies.active, level->enemies.active, sizeof(uint32_t) * FLAG_WORDS(enemies));
+    memcpy(world->enemies.lastTick, level->enemies.lastTick, sizeof(uint32_t) * enemies);
+    memcpy(world->enemies.wakeTick, level->enemies.wakeTick, sizeof(uint32_t) * enemies);
+    world->enemySchedule.stale = true;
+    memcpy(world->blocks.hit, level->blocks.hit, sizeof(uint32_t) * FLAG_WORDS(level->blocks.count));
+    memcpy(world->coins.collected, level->coins.collected, sizeof(uint32_t) * FLAG_WORDS(level->coins.count));
+    CopyGrid(&world->enemyGrid, &level->enemyGrid);
+    CopyGrid(&world->coinGrid, &level->coinGrid);
+}
+
+// En yakın `slots` elemanı mesafeye göre sıralı tutar; eşitlikte küçük indeks önce
+typedef struct {
+    int count;
+    int ids[BATCH_OBS_ENEMIES > BATCH_OBS_COINS ? BATCH_OBS_ENEMIES : BATCH_OBS_COINS];
+    float distance[BATCH_OBS_ENEMIES > BATCH_OBS_COINS ? BATCH_OBS_ENEMIES : BATCH_OBS_COINS];
+} Nearest;
+
+static void OfferNearest(Nearest* nearest, int slots, int id, float distance) {
+    int k = nearest->count;
+    if (k == slots) {
+        if (distance > nearest->distance[k - 1] || (distance == nearest->distance[k - 1] && id > nearest->ids[k - 1])) return;
+        k--;
+    }
+    else {
+        nearest->count++;
+    }
+    while (k > 0 && (nearest->distance[k - 1] > distance || (nearest->distance[k - 1] == distance && nearest->ids[k - 1] > id))) {
+        nearest->ids[k] = nearest->ids[k - 1];
+        nearest->distance[k] = nearest->distance[k - 1];
+        k--;
+    }
+    nearest->ids[k] = id;
+    nearest->distance[k] = distance;
+}
+
+static float* WriteNearest(float* out, const Nearest* nearest, int slots, const float* x, const float* y, Vector2 mario) {
+    for (int k = 0; k < slots; k++) {
+        if (k < nearest->count) {
+            int id = nearest->ids[k];
+            out[0] = 1.0f;
+            out[1] = (x[id] - mario.x) / BLOCK_SIZE;
+            out[2] = (y[id] - mario.y) / BLOCK_SIZE;
+        }
+        else {
+            out[0] = out[1] = out[2] = 0.0f;
+        }
+        out += 3;
+    }
+    return out;
+}
+
+static void WriteObservation(const World* world, float* obs) {
+    Vector2 mario = world->marioPosition;
+    obs[0] = mario.x / (float)world->levelLength;
+    obs[1] = (world->groundY - MARIO_BASE_HEIGHT - mario.y) / BLOCK_SIZE;
+    obs[2] = world->velocityY / MARIO_JUMP_FORCE;
+    obs[3] = world->isJumping ? 1.0f : 0.0f;
+
+    Rectangle area = { mario.x - BATCH_OBS_RANGE, mario.y - BATCH_OBS_RANGE, 2 * BATCH_OBS_RANGE, 2 * BATCH_OBS_RANGE };
+    SpatialQuery query;
+    int id;
+
+    Nearest enemies = { 0 };
+    BeginSpatialQuery(&world->enemyGrid, area, &query);
+    while ((id = NextSpatialQuery(&query)) != -1) {
+        if (!GetFlag(world->enemies.active, id)) continue;
+        float dx = world->enemies.x[id] - mario.x, dy = world->enemies.y[id] - mario.y;
+        OfferNearest(&enemies, BATCH_OBS_ENEMIES, id, dx * dx + dy * dy);
+    }
+    Nearest coins = { 0 };
+    BeginSpatialQuery(&world->coinGrid, area, &query);
+    while ((id = NextSpatialQuery(&query)) != -1) {
+        if (GetFlag(world->coins.collected, id) || world->coins.width[id] == 0) continue;
+        float dx = world->coins.x[id] - mario.x, dy = world->coins.y[id] - mario.y;
+        OfferNearest(&coins, BATCH_OBS_COINS, id, dx * dx + dy * dy);
+    }
+
+    float* out = WriteNearest(obs + 4, &enemies, BATCH_OBS_ENEMIES, world->enemies.x, world->enemies.y, mario);
+    WriteNearest(out, &coins, BATCH_OBS_COINS, world->coins.x, world->coins.y, mario);
+}
+
+bool InitBatchEnv(BatchEnv* env, const World* level, int count, int maxTicks, JobSystem* jobs) {
+    memset(env, 0, sizeof(*env));
+    SlabLayout layout = GetSlabLayout(level);
+    env->worlds = malloc(sizeof(World) * (count > 0 ? count : 1));
+    env->ticks = calloc(count > 0 ? count : 1, sizeof(int));
+    env->slab = malloc(layout.total * (count > 0 ? count : 1));
+    if (env->worlds == NULL || env->ticks == NULL || env->slab == NULL) {
+        FreeBatchEnv(env);
+        return false;
+    }
+    env->level = level;
+    env->envBytes = layout.total;
+    env->count = count;
+    env->maxTicks = maxTicks;
+    env->actionRepeat = 1;
+    env->jobs = jobs;
+    for (int i = 0; i < count; i++) {
+        BindWorld(&env->worlds[i], level, env->slab + layout.total * i, &layout);
+    }
+    ResetBatchEnv(env, NULL);
+    return true;
+}
+
+void FreeBatchEnv(BatchEnv* env) {
+    free(env->worlds);
+    free(env->ticks);
+    free(env->slab);
+    memset(env, 0, sizeof(*env));
+}
+
+typedef struct {
+    BatchEnv* env;
+    const uint8_t* actions;
+    float* observations;
+    float* rewards;
+    uint8_t* done;
+} BatchStep;
+
+static void ResetRange(void* data, int begin, int end) {
+    BatchStep* step = data;
+    for (int i = begin; i < end; i++) {
+        ResetWorld(&step->env->worlds[i], step->env->level);
+        step->env->ticks[i] = 0;
+        if (step->observations != NULL) WriteObservation(&step->env->worlds[i], step->observations + (size_t)i * BATCH_OBS_SIZE);
+    }
+}
+
+static void StepRange(void* data, int begin, int end) {
+    BatchStep* step = data;
+    BatchEnv* env = step->env;
+    for (int i = begin; i < end; i++) {
+        World* world = &env->worlds[i];
+        int score = world->score;
+        int repeat = env->actionRepeat > 1 ? env->actionRepeat : 1;
+        if (env->maxTicks > 0 && repeat > env->maxTicks - env->ticks[i]) repeat = env->maxTicks - env->ticks[i];
+        StepWorldTicks(world, UnpackInput(step->actions[i]), repeat);
+        step->rewards[i] = (float)(world->score - score);
+
+        env->ticks[i] += repeat;
+        bool finished = world->marioPosition.x >= GROUND_START_X + world->levelLength - MARIO_WALK_FRAME_WIDTH ||
+            (env->maxTicks > 0 && env->ticks[i] >= env->maxTicks);
+        step->done[i] = finished ? 1 : 0;
+        if (finished) {
+            ResetWorld(world, env->level);
+            env->ticks[i] = 0;
+        }
+        WriteObservation(world, step->observations + (size_t)i * BATCH_OBS_SIZE);
+    }
+}
+
+void ResetBatchEnv(BatchEnv* env, float* observations) {
+    BatchStep step = { env, NULL, observations, NULL, NULL };
+    ParallelFor(env->jobs, env->count, BATCH_ENV_CHUNK, ResetRange, &step);
+}
+
+void StepBatchEnv(BatchEnv* env, const uint8_t* actions, float* observations, float* rewards, uint8_t* done) {
+    BatchStep step = { env, actions, observations, rewards, done };
+    ParallelFor(env->jobs, env->count, BATCH_ENV_CHUNK, StepRange, &step);
+}
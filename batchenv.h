@@ -0,0 +1,57 @@
+#ifndef BATCHENV_H
+#define BATCHENV_H
+
+// Toplu simülasyon: aynı parkurda N bağımsız oyun (ajan eğitimi, parkur
+// testleri). Parkurun değişmeyen kısmı (blok geometrisi, blok grid'i,
+// düşman/coin boyutları) şablon World'den paylaşılır; her ortamın değişen
+// durumu (düşman konum/yön/aktiflik/takvim, vurulan blok, toplanan coin, düşman
+// ve coin grid'leri) tek bir bellek bloğunda ardışık tutulur. Ortamlar
+// pencere veya ses olmadan StepWorld ile ilerler, iş sistemine dağıtılır.
+//
+// Gözlem (ortam başına BATCH_OBS_SIZE float):
+//   [0] x / levelLength, [1] zeminden yükseklik / BLOCK_SIZE,
+//   [2] velocityY / MARIO_JUMP_FORCE, [3] isJumping,
+//   sonra en yakın BATCH_OBS_ENEMIES düşman ve BATCH_OBS_COINS coin için
+//   (var mı, dx / BLOCK_SIZE, dy / BLOCK_SIZE), yakından uzağa.
+// Ödül: o adımda HandleCollisions'ın verdiği skor farkı.
+//
+// actionRepeat > 1 ise her adımda eylem o kadar tick uygulanır (zıplama
+// yalnızca ilk tick'te); StepWorldTicks ara tick'leri süpürülmüş
+// çarpışmayla tek seferde çözer. Bitiş adım sonunda denetlenir.
+
+#include "jobs.h"
+#include "world.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define BATCH_OBS_ENEMIES 4
+#define BATCH_OBS_COINS 4
+#define BATCH_OBS_SIZE (4 + 3 * BATCH_OBS_ENEMIES + 3 * BATCH_OBS_COINS)
+#define BATCH_OBS_RANGE (5 * BLOCK_SIZE) // Mario'ya bu uzaklıktaki elemanlar görünür
+#define BATCH_ENV_CHUNK 64               // İş parçası başına ortam
+
+typedef struct {
+    World* worlds;       // count adet; statik diziler şablonu gösterir, FreeWorld çağrılmaz
+    const World* level;  // Şablon: kurulmuş ve grid'leri hazır, adımlanmamış; sahibi çağıran
+    uint8_t* slab;       // Tüm ortamların değişen dizileri
+    size_t envBytes;     // Ortam başına slab payı (önbellek satırına hizalı)
+    int* ticks;          // Bölümdeki tick sayısı
+    int count;
+    int maxTicks;        // Bölüm uzunluğu sınırı, 0 ise sınırsız
+    int actionRepeat;    // Adım başına tick, InitBatchEnv 1 yapar
+    JobSystem* jobs;     // NULL ise seri
+} BatchEnv;
+
+// Akışlı parkurlar desteklenmez: şablonda parkurun tamamı yüklü olmalı.
+bool InitBatchEnv(BatchEnv* env, const World* level, int count, int maxTicks, JobSystem* jobs);
+void FreeBatchEnv(BatchEnv* env);
+
+// Tüm ortamları başlangıç durumuna döndürür; observations NULL olabilir.
+void ResetBatchEnv(BatchEnv* env, float* observations);
+
+// actions: ortam başına PackInput bitleri. rewards ve done ortam başına
+// bir eleman; biten ortam (parkur sonu veya maxTicks) kendiliğinden
+// sıfırlanır ve gözlemi yeni bölümün ilk gözlemidir.
+void StepBatchEnv(BatchEnv* env, const uint8_t* actions, float* observations, float* rewards, uint8_t* done);
+
+#endif
@@ -0,0 +1,745 @@
+// Pencere açmadan çalışan performans ölçümü: parametrelerden sentetik
+// parkur üretir, StepWorld'ü N tick koşturur ve sonuçları JSON olarak
+// stdout'a yazar. Ekransız Linux makinede derlemek için:
+//
+//   gcc -O2 -std=c11 -I<raylib>/include -o algolab_bench bench.c world.c spatial.c
+//       entities.c collide.c level.c mapfile.c thread.c jobs.c profiler.c replay.c batchenv.c snapshot.c rollback.c particles.c
+//       navgrid.c wakewheel.c -lm -lpthread
+//
+// Çekirdek raylib fonksiyonu çağırmadığı için yalnızca başlık gerekir.
+//
+// Kullanım: algolab_bench [--ticks N] [--seed N] [--max-scale N] [--threads N]
+//                         [--blocks N --enemies N --coin-density F --length N]
+// Tek boyut verilmezse MAX_* sınırlarından başlayıp x10 adımlarla büyür.
+// --threads 1'den büyükse düşmanlar iş sistemiyle paralel güncellenir.
+// --lod 0 uzaktaki düşmanların seyrek güncellenmesini kapatır (karşılaştırma için).
+// --chase 1 düşmanlara gezinme ızgarası verir; ENEMY_CHASE_DISTANCE içinde
+// Mario'yu kovalarlar.
+// --replay <dosya> [--resources <dizin>] kayıtlı oynanışı sabit iş yükü olarak
+// koşturur ve tick hash'leri tutmazsa 2 ile çıkar.
+// --batch N mini level'da N ortamı rastgele girdilerle birlikte adımlar;
+// --repeat N her eylemi N tick uygular (StepWorldTicks).
+// --rollback N girdiyi N tick gecikmeyle (ve titremeyle) gönderen yerel eşe
+// karşı rollback oturumu koşturur; sonuç doğrudan simülasyonla tutmazsa 2
+// ile çıkar. --level <dosya> verilirse akışlı parkur kullanılır.
+// --particles N havuzu N canlı parçacıkta tutup UpdateParticles'ı ölçer.
+// --compare-lod 1 aynı parkuru kovalama açıkken LOD kapalı ve açık koşturur;
+// düşman durumları tutmazsa 2 ile çıkar (parkur boyutu verilmezse x100).
+// Önce kısa parkur ve parkur dışı düşman gibi devriye uç durumlarında
+// uykudan yetiştirmeyi her tick güncellemeyle karşılaştırır.
+
+#include "batchenv.h"
+#include "navgrid.h"
+#include "particles.h"
+#include "world.h"
+#include "replay.h"
+#include "rng.h"
+#include "rollback.h"
+#include "snapshot.h"
+#include "thread.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_DEFAULT_TICKS 2000
+#define BENCH_MAX_LENGTH 4000000 // float konumlar bu uzunlukta hâlâ 0.25px hassas
+#define BENCH_COLLIDE_TESTS 1000000
+#define BENCH_SNAPSHOT_REPEATS 1000
+#define BENCH_REWIND_FRAMES 600
+#define BENCH_REWIND_BYTES (4 << 20)
+
+typedef struct {
+    int blockCount;
+    int enemyCount;
+    float coinDensity; // 1000 px başına coin
+    int levelLength;
+} BenchLevel;
+
+typedef struct {
+    uint64_t totalNs;
+    uint64_t p50Ns;
+    uint64_t p99Ns;
+    uint64_t maxNs;
+} TickStats;
+
+static uint32_t benchRng; // xorshift: platformdan bağımsız, her koşuda aynı parkur
+static bool benchEnemyLod = true;
+static bool benchEnemyChase = false;
+
+// Bloklar BLOCK_SIZE'lık sütunlara dağıtılır: bir kısmı zeminde duvar
+// (düşmanları döndürür), kalanı üst üste platform sıraları. Düşmanlar
+// zeminde, coin'ler platformların üstünde.
+static bool GenerateLevel(World* world, const BenchLevel* params, int groundY) {
+    int coinCount = (int)((double)params->coinDensity * params->levelLength / 1000.0);
+    if (!InitWorld(world, groundY, params->blockCount, params->enemyCount, coinCount)) return false;
+    world->levelLength = params->levelLength;
+    world->enemyLod = benchEnemyLod;
+
+    int columns = params->levelLength / BLOCK_SIZE;
+    if (columns < 1) columns = 1;
+    int rows = params->blockCount / columns + 1;
+    for (int i = 0; i < params->blockCount; i++) {
+        int column = RandomRange(&benchRng, 0, columns - 1);
+        float x = (float)(GROUND_START_X + column * BLOCK_SIZE);
+        if (NextRandom(&benchRng) % 10 == 0) {
+            AddBlock(&world->blocks, (Rectangle){ x, groundY - BLOCK_SIZE, BLOCK_SIZE, BLOCK_SIZE }, BLOCK_STONE, false);
+            continue;
+        }
+        int row = RandomRange(&benchRng, 0, rows - 1);
+        float y = (float)(groundY - BLOCK_SIZE - 40 - row * BLOCK_SIZE * 2);
+        BlockType type = (NextRandom(&benchRng) % 2 == 0) ? BLOCK_STONE : BLOCK_QUESTION;
+        AddBlock(&world->blocks, (Rectangle){ x, y, BLOCK_SIZE, BLOCK_SIZE }, type, type == BLOCK_QUESTION);
+    }
+    for (int i = 0; i < params->enemyCount; i++) {
+        float x = (float)RandomRange(&benchRng, GROUND_START_X, GROUND_START_X + params->levelLength - ENEMY_SIZE);
+        AddEnemy(&world->enemies, (Rectangle){ x, groundY - ENEMY_SIZE, ENEMY_SIZE, ENEMY_SIZE },
+            (NextRandom(&benchRng) % 2 == 0) ? 1 : -1, 2.0f);
+    }
+    for (int i = 0; i < coinCount; i++) {
+        float x = (float)RandomRange(&benchRng, GROUND_START_X, GROUND_START_X + params->levelLength - COIN_SIZE);
+        int row = RandomRange(&benchRng, 0, rows - 1);
+        float y = (float)(groundY - BLOCK_SIZE - 40 - row * BLOCK_SIZE * 2 - COIN_SIZE);
+        AddCoin(&world->coins, (Rectangle){ x, y, COIN_SIZE, COIN_SIZE });
+    }
+    BuildWorldGrids(world);
+    if (benchEnemyChase && !InitWorldNavFromBlocks(world)) {
+        FreeWorld(world);
+        return false;
+    }
+    return true;
+}
+
+// Sabit girdi senaryosu: sağa koşar, düzenli zıplar, parkur sonunda döner
+static WorldInput ScriptedInput(const World* world, int tick, bool* goingRight) {
+    if (world->marioPosition.x >= GROUND_START_X + world->levelLength - MARIO_WALK_FRAME_WIDTH) *goingRight = false;
+    if (world->marioPosition.x <= GROUND_START_X) *goingRight = true;
+    WorldInput input = { !*goingRight, *goingRight, tick % 45 == 0 };
+    return input;
+}
+
+static int CompareU64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+static TickStats SummarizeTicks(uint64_t* samples, int count) {
+    TickStats stats = { 0 };
+    for (int i = 0; i < count; i++) stats.totalNs += samples[i];
+    qsort(samples, count, sizeof(uint64_t), CompareU64);
+    stats.p50Ns = samples[(count - 1) / 2];
+    stats.p99Ns = samples[(int)((count - 1) * 0.99)];
+    stats.maxNs = samples[count - 1];
+    return stats;
+}
+
+static TickStats RunStepWorld(World* world, int ticks, uint64_t* samples) {
+    bool goingRight = true;
+    for (int tick = 0; tick < ticks; tick++) {
+        WorldInput input = ScriptedInput(world, tick, &goingRight);
+        uint64_t start = GetMonotonicNs();
+        StepWorld(world, input);
+        samples[tick] = GetMonotonicNs() - start;
+    }
+    return SummarizeTicks(samples, ticks);
+}
+
+// Aşamaları ayrı ölçmek için: aynı tick'te StepWorld'ün yaptığı çağrıların aynısı
+static uint64_t RunUpdateEnemies(World* world, int ticks) {
+    uint64_t start = GetMonotonicNs();
+    for (int tick = 0; tick < ticks; tick++) {
+        world->tick++;
+        EnemyLod lod = GetEnemyLod(world);
+        if (world->nav != NULL) UpdateFlowField(world->nav, lod.focusX, world->marioPosition.y + MARIO_BASE_HEIGHT);
+        if (world->jobs != NULL) {
+            UpdateEnemiesParallel(world->jobs, &world->enemies, &world->enemyGrid, &world->enemySchedule, &world->blocks, &world->blockGrid,
+                world->levelLength, world->nav, &lod);
+        }
+        else {
+            UpdateEnemies(&world->enemies, &world->enemyGrid, &world->enemySchedule, &world->blocks, &world->blockGrid, world->levelLength,
+                world->nav, &lod);
+        }
+    }
+    return GetMonotonicNs() - start;
+}
+
+static uint64_t RunHandleCollisions(World* world, int ticks) {
+    bool goingRight = true;
+    uint64_t total = 0;
+    for (int tick = 0; tick < ticks; tick++) {
+        WorldInput input = ScriptedInput(world, tick, &goingRight);
+        world->marioPosition.x += input.right ? MARIO_SPEED : -MARIO_SPEED;
+        Rectangle marioCollider = { world->marioPosition.x, world->marioPosition.y, MARIO_WALK_FRAME_WIDTH, MARIO_WALK_FRAME_HEIGHT };
+        uint64_t start = GetMonotonicNs();
+        HandleCollisions(&world->marioPosition, marioCollider, &world->isJumping, &world->velocityY,
+            &world->blocks, &world->blockGrid, &world->enemies, &world->enemyGrid, &world->coins, &world->coinGrid,
+            &world->score, world->groundY, &world->events);
+        world->events.count = 0;
+        total += GetMonotonicNs() - start;
+    }
+    return total;
+}
+
+// Tek dikdörtgen testi: tüm bloklara karşı skaler ve batch yol
+static void RunCheckCollision(const World* world, double* scalarNs, double* batchNs) {
+    const BlockSet* blocks = &world->blocks;
+    int count = blocks->count < BENCH_COLLIDE_TESTS ? blocks->count : BENCH_COLLIDE_TESTS;
+    int passes = (count > 0) ? BENCH_COLLIDE_TESTS / count : 0;
+    Rectangle probe = { (float)MARIO_START_X, (float)(world->groundY - MARIO_BASE_HEIGHT), MARIO_WALK_FRAME_WIDTH, MARIO_WALK_FRAME_HEIGHT };
+    volatile int sink = 0;
+    *scalarNs = *batchNs = 0.0;
+    if (count == 0) return;
+
+    uint64_t start = GetMonotonicNs();
+    for (int pass = 0; pass < passes; pass++) {
+        int hits = 0;
+        for (int i = 0; i < count; i++) hits += CheckCollision(probe, GetBlockRect(blocks, i));
+        sink += hits;
+    }
+    *scalarNs = (double)(GetMonotonicNs() - start) / ((double)passes * count);
+
+    start = GetMonotonicNs();
+    for (int pass = 0; pass < passes; pass++) {
+        int hits = 0;
+        for (int i = 0; i < count; i += COLLIDE_BATCH) {
+            int n = count - i < COLLIDE_BATCH ? count - i : COLLIDE_BATCH;
+            uint32_t mask;
+            hits += CheckCollisionBatch(probe, blocks->x + i, blocks->y + i, blocks->width + i, blocks->height + i, n, &mask);
+        }
+        sink += hits;
+    }
+    *batchNs = (double)(GetMonotonicNs() - start) / ((double)passes * count);
+    (void)sink;
+}
+
+static bool RunBenchmark(const BenchLevel* params, int ticks, uint32_t seed, JobSystem* jobs, bool first) {
+    const int groundY = 700;
+    World world;
+    uint64_t* samples = malloc(sizeof(uint64_t) * ticks);
+    if (samples == NULL) return false;
+
+    benchRng = seed;
+    if (!GenerateLevel(&world, params, groundY)) {
+        free(samples);
+        return false;
+    }
+    int coinCount = world.coins.count;
+    world.jobs = jobs;
+    TickStats step = RunStepWorld(&world, ticks, samples);
+    int score = world.score;
+    double scalarNs, batchNs;
+    RunCheckCollision(&world, &scalarNs, &batchNs);
+    FreeWorld(&world);
+
+    // Aşama ölçümleri aynı tohumla üretilmiş taze parkurda yapılır
+    benchRng = seed;
+    if (!GenerateLevel(&world, params, groundY)) {
+        free(samples);
+        return false;
+    }
+    world.jobs = jobs;
+    uint64_t enemiesNs = RunUpdateEnemies(&world, ticks);
+    FreeWorld(&world);
+    benchRng = seed;
+    if (!GenerateLevel(&world, params, groundY)) {
+        free(samples);
+        return false;
+    }
+    uint64_t collisionsNs = RunHandleCollisions(&world, ticks);
+    FreeWorld(&world);
+    free(samples);
+
+    double nsPerTick = (double)step.totalNs / ticks;
+    printf("%s    {\"blocks\": %d, \"enemies\": %d, \"coins\": %d, \"levelLength\": %d, \"ticks\": %d, \"threads\": %d, \"enemyLod\": %s,"
+        " \"chase\": %s,\n",
+        first ? "" : ",\n", params->blockCount, params->enemyCount, coinCount, params->levelLength, ticks,
+        jobs != NULL ? jobs->workerCount + 1 : 1, benchEnemyLod ? "true" : "false", benchEnemyChase ? "true" : "false");
+    printf("     \"nsPerTick\": %.1f, \"ticksPerSec\": %.1f, \"p50Ns\": %llu, \"p99Ns\": %llu, \"maxNs\": %llu,\n",
+        nsPerTick, nsPerTick > 0 ? 1e9 / nsPerTick : 0.0,
+        (unsigned long long)step.p50Ns, (unsigned long long)step.p99Ns, (unsigned long long)step.maxNs);
+    printf("     \"updateEnemiesNsPerTick\": %.1f, \"handleCollisionsNsPerTick\": %.1f,\n",
+        (double)enemiesNs / ticks, (double)collisionsNs / ticks);
+    printf("     \"checkCollisionNs\": %.3f, \"checkCollisionBatchNs\": %.3f, \"score\": %d}",
+        scalarNs, batchNs, score);
+    fflush(stdout);
+    return true;
+}
+
+// Aynı parkur ve girdilerle LOD kapalı (her düşman her tick) ve açık
+// koşturulur; uyuyanlar sonda yetiştirilip düşman durumları ve skor
+// karşılaştırılır. Kovalama açıktır: menzilden çıkan düşmanın zemine
+// oturtulması da iki yolda aynı olmalı.
+static bool RunLodComparison(const BenchLevel* params, int ticks, uint32_t seed, JobSystem* jobs) {
+    const int groundY = 700;
+    World reference, world;
+    benchEnemyChase = true;
+    benchEnemyLod = false;
+    benchRng = seed;
+    if (!GenerateLevel(&reference, params, groundY)) return false;
+    benchEnemyLod = true;
+    benchRng = seed;
+    if (!GenerateLevel(&world, params, groundY)) {
+        FreeWorld(&reference);
+        return false;
+    }
+    world.jobs = jobs;
+
+    bool goingRight = true;
+    int firstMismatch = -1;
+    uint64_t referenceNs = 0, lodNs = 0;
+    for (int tick = 0; tick < ticks; tick++) {
+        WorldInput input = ScriptedInput(&reference, tick, &goingRight);
+        uint64_t start = GetMonotonicNs();
+        StepWorld(&reference, input);
+        uint64_t middle = GetMonotonicNs();
+        StepWorld(&world, input);
+        referenceNs += middle - start;
+        lodNs += GetMonotonicNs() - middle;
+        if (firstMismatch < 0 && (world.score != reference.score || world.marioPosition.x != reference.marioPosition.x ||
+            world.marioPosition.y != reference.marioPosition.y)) {
+            firstMismatch = tick;
+        }
+    }
+    CatchUpEnemies(&world);
+
+    const EnemySet* a = &reference.enemies;
+    const EnemySet* b = &world.enemies;
+    int mismatches = 0;
+    for (int i = 0; i < a->count; i++) {
+        bool active = GetFlag(a->active, i);
+        if (active != GetFlag(b->active, i) ||
+            (active && (a->x[i] != b->x[i] || a->y[i] != b->y[i] || a->velocityY[i] != b->velocityY[i] || a->direction[i] != b->direction[i]))) {
+            mismatches++;
+        }
+    }
+    bool matched = mismatches == 0 && firstMismatch < 0;
+    printf("{\"benchmark\": \"lod\", \"seed\": %u, \"blocks\": %d, \"enemies\": %d, \"levelLength\": %d, \"ticks\": %d, \"threads\": %d,\n",
+        seed, params->blockCount, params->enemyCount, params->levelLength, ticks, jobs != NULL ? jobs->workerCount + 1 : 1);
+    printf(" \"referenceNsPerTick\": %.1f, \"lodNsPerTick\": %.1f, \"score\": %d, \"enemyMismatches\": %d, \"firstMismatchTick\": %d,"
+        " \"matched\": %s}\n", (double)referenceNs / ticks, (double)lodNs / ticks, world.score, mismatches, firstMismatch,
+        matched ? "true" : "false");
+    FreeWorld(&reference);
+    FreeWorld(&world);
+    return matched;
+}
+
+// Tek düşmanlı küçük parkurlarda `ticks` tick'lik uykudan yetiştirme
+// (CatchUpEnemies) her tick güncellemeyle karşılaştırılır: düşmandan kısa
+// parkur, parkur dışında başlayan düşman, duvar ve negatif hız.
+static bool RunPatrolEdgeCheck(int ticks) {
+    const int groundY = 700;
+    const int lengths[] = { 10, ENEMY_SIZE, ENEMY_SIZE + 1, 300 };
+    const float startX[] = { 500.0f, -30.0f, 5.0f, 150.0f };
+    const float speeds[] = { 2.0f, 0.75f, -2.0f };
+    int cases = 0, mismatches = 0;
+    for (int l = 0; l < (int)(sizeof(lengths) / sizeof(lengths[0])); l++) {
+        for (int s = 0; s < (int)(sizeof(startX) / sizeof(startX[0])); s++) {
+            for (int v = 0; v < (int)(sizeof(speeds) / sizeof(speeds[0])); v++) {
+                for (int wall = 0; wall < 2; wall++) {
+                    for (int direction = -1; direction <= 1; direction += 2) {
+                        World reference, world;
+                        World* worlds[2] = { &reference, &world };
+                        for (int w = 0; w < 2; w++) {
+                            if (!InitWorld(worlds[w], groundY, 1, 1, 0)) {
+                                if (w == 1) FreeWorld(&reference);
+                                return false;
+                            }
+                            worlds[w]->levelLength = lengths[l];
+                            worlds[w]->enemyLod = false;
+                            if (wall) {
+                                AddBlock(&worlds[w]->blocks, (Rectangle){ GROUND_START_X + 100, groundY - BLOCK_SIZE, BLOCK_SIZE, BLOCK_SIZE },
+                                    BLOCK_STONE, false);
+                            }
+                            AddEnemy(&worlds[w]->enemies, (Rectangle){ startX[s], groundY - ENEMY_SIZE, ENEMY_SIZE, ENEMY_SIZE },
+                                direction, speeds[v]);
+                            BuildWorldGrids(worlds[w]);
+                        }
+                        for (int tick = 0; tick < ticks; tick++) {
+                            reference.tick++;
+                            EnemyLod lod = GetEnemyLod(&reference);
+                            UpdateEnemies(&reference.enemies, &reference.enemyGrid, &reference.enemySchedule, &reference.blocks,
+                                &reference.blockGrid, reference.levelLength, NULL, &lod);
+                        }
+                        world.tick = (uint32_t)ticks;
+                        CatchUpEnemies(&world);
+                        if (reference.enemies.x[0] != world.enemies.x[0] ||
+                            reference.enemies.direction[0] != world.enemies.direction[0]) {
+                            mismatches++;
+                        }
+                        cases++;
+                        FreeWorld(&reference);
+                        FreeWorld(&world);
+                    }
+                }
+            }
+        }
+    }
+    printf("{\"benchmark\": \"patrol-edges\", \"ticks\": %d, \"cases\": %d, \"mismatches\": %d, \"matched\": %s}\n",
+        ticks, cases, mismatches, mismatches == 0 ? "true" : "false");
+    return mismatches == 0;
+}
+
+// Kayıtlı oynanışı sabit iş yükü olarak koşturur; parkur dosyası resourceRoot'a göre
+static bool RunReplayBenchmark(const char* path, const char* resourceRoot, JobSystem* jobs) {
+    Replay replay;
+    if (!LoadReplay(&replay, path)) {
+        fprintf(stderr, "kayit okunamadi: %s\n", path);
+        return false;
+    }
+    char levelPath[512];
+    const char* levelFile = NULL;
+    if (replay.header.level[0] != '\0') {
+        snprintf(levelPath, sizeof(levelPath), "%s/%s", resourceRoot, replay.header.level);
+        levelFile = levelPath;
+    }
+    int ticks = (int)replay.header.tickCount;
+    uint64_t* samples = malloc(sizeof(uint64_t) * (ticks > 0 ? ticks : 1));
+    World world;
+    Level level;
+    bool isStreaming = false;
+    bool ok = samples != NULL && ticks > 0 && InitGameWorld(&world, &level, levelFile, replay.header.groundY, &isStreaming);
+    if (ok && levelFile != NULL && !isStreaming) {
+        FreeGameWorld(&world, &level, isStreaming);
+        ok = false;
+    }
+    if (!ok) {
+        fprintf(stderr, "kayit oynatilamadi: %s\n", path);
+        free(samples);
+        FreeReplay(&replay);
+        return false;
+    }
+
+    world.jobs = jobs;
+    int mismatch = PlayReplay(&replay, &world, &level, isStreaming, samples);
+    TickStats stats = SummarizeTicks(samples, ticks);
+    double nsPerTick = (double)stats.totalNs / ticks;
+    printf("{\"benchmark\": \"replay\", \"seed\": %u, \"ticks\": %d, \"threads\": %d,\n", replay.header.seed, ticks,
+        jobs != NULL ? jobs->workerCount + 1 : 1);
+    printf(" \"nsPerTick\": %.1f, \"ticksPerSec\": %.1f, \"p50Ns\": %llu, \"p99Ns\": %llu, \"maxNs\": %llu,\n",
+        nsPerTick, nsPerTick > 0 ? 1e9 / nsPerTick : 0.0,
+        (unsigned long long)stats.p50Ns, (unsigned long long)stats.p99Ns, (unsigned long long)stats.maxNs);
+    printf(" \"mismatchTick\": %d, \"score\": %d}\n", mismatch, world.score);
+
+    FreeGameWorld(&world, &level, isStreaming);
+    free(samples);
+    FreeReplay(&replay);
+    return mismatch < 0;
+}
+
+// Oyunun mini level'ı şablon; her ortam her adımda kendi rastgele girdisini alır
+static bool RunBatchBenchmark(int envCount, int ticks, int repeat, uint32_t seed, JobSystem* jobs) {
+    const int groundY = 700;
+    World level;
+    if (!InitWorld(&level, groundY, MAX_BLOCKS, MAX_ENEMIES, MAX_COINS)) return false;
+    InitLevel(&level.blocks, &level.enemies, &level.coins, level.groundY);
+    BuildWorldGrids(&level);
+    level.enemyLod = benchEnemyLod;
+
+    BatchEnv env;
+    uint8_t* actions = malloc(envCount);
+    float* observations = malloc(sizeof(float) * BATCH_OBS_SIZE * envCount);
+    float* rewards = malloc(sizeof(float) * envCount);
+    uint8_t* done = malloc(envCount);
+    bool ok = actions != NULL && observations != NULL && rewards != NULL && done != NULL &&
+        InitBatchEnv(&env, &level, envCount, ticks / 4, jobs);
+    if (ok) {
+        env.actionRepeat = repeat;
+        benchRng = seed;
+        ResetBatchEnv(&env, observations);
+        double totalReward = 0.0;
+        int episodes = 0;
+        uint64_t start = GetMonotonicNs();
+        for (int tick = 0; tick < ticks; tick++) {
+            for (int i = 0; i < envCount; i++) {
+                // Çoğunlukla sağa koşan, ara sıra zıplayan ajan
+                uint32_t r = NextRandom(&benchRng);
+                actions[i] = (uint8_t)(((r & 7) != 0 ? REPLAY_INPUT_RIGHT : REPLAY_INPUT_LEFT) | ((r >> 3) % 20 == 0 ? REPLAY_INPUT_JUMP : 0));
+            }
+            StepBatchEnv(&env, actions, observations, rewards, done);
+            for (int i = 0; i < envCount; i++) {
+                totalReward += rewards[i];
+                episodes += done[i];
+            }
+        }
+        uint64_t elapsed = GetMonotonicNs() - start;
+        double steps = (double)ticks * envCount;
+        printf("{\"benchmark\": \"batch\", \"seed\": %u, \"envs\": %d, \"ticks\": %d, \"actionRepeat\": %d, \"threads\": %d,\n", seed,
+            envCount, ticks, repeat, jobs != NULL ? jobs->workerCount + 1 : 1);
+        printf(" \"envBytes\": %zu, \"nsPerEnvStep\": %.1f, \"envStepsPerSec\": %.1f, \"episodes\": %d, \"meanReward\": %.4f}\n",
+            env.envBytes, (double)elapsed / steps, elapsed > 0 ? steps * 1e9 / (double)elapsed : 0.0, episodes, totalReward / steps);
+        FreeBatchEnv(&env);
+    }
+    free(actions);
+    free(observations);
+    free(rewards);
+    free(done);
+    FreeWorld(&level);
+    return ok;
+}
+
+// Girdiyi üreten eş aynı süreçte: tick t'nin girdisi t + delay + [0, delay/2]
+// anında, sırayı bozmadan teslim edilir. Aynı girdilerle doğrudan koşan
+// referans dünyayla son durum karşılaştırılır. Referans her tick geri sarma
+// halkasına yazılır; sonda geri sarılıp yeniden ileri koşturulan referans da
+// aynı duruma varmalıdır.
+static bool RunRollbackBenchmark(int delay, int ticks, uint32_t seed, const char* levelPath) {
+    const int groundY = 700;
+    uint8_t* inputs = malloc(ticks);
+    int* arrival = malloc(sizeof(int) * ticks);
+    World world, reference;
+    Level level, referenceLevel;
+    bool isStreaming = false, referenceStreaming = false;
+    if (inputs == NULL || arrival == NULL || !InitGameWorld(&world, &level, levelPath, groundY, &isStreaming)) {
+        free(inputs);
+        free(arrival);
+        return false;
+    }
+    if (levelPath != NULL && !isStreaming) {
+        fprintf(stderr, "parkur acilamadi: %s\n", levelPath);
+        FreeGameWorld(&world, &level, isStreaming);
+        free(inputs);
+        free(arrival);
+        return false;
+    }
+    if (!InitGameWorld(&reference, &referenceLevel, levelPath, groundY, &referenceStreaming)) {
+        FreeGameWorld(&world, &level, isStreaming);
+        free(inputs);
+        free(arrival);
+        return false;
+    }
+    world.enemyLod = reference.enemyLod = benchEnemyLod;
+
+    benchRng = seed;
+    int last = 0;
+    for (int t = 0; t < ticks; t++) {
+        uint32_t r = NextRandom(&benchRng);
+        inputs[t] = (uint8_t)(((r & 7) != 0 ? REPLAY_INPUT_RIGHT : REPLAY_INPUT_LEFT) | ((r >> 3) % 20 == 0 ? REPLAY_INPUT_JUMP : 0));
+        int at = t + delay + (delay > 0 ? RandomRange(&benchRng, 0, delay / 2) : 0);
+        arrival[t] = last = at > last ? at : last;
+    }
+
+    RollbackSession session;
+    SnapshotLayout layout;
+    SnapshotRing ring;
+    bool ok = InitRollbackSession(&session, &world, &level, isStreaming);
+    InitSnapshotLayout(&layout, &reference, referenceStreaming ? &referenceLevel : NULL);
+    bool hasRing = ok && InitSnapshotRing(&ring, &layout, BENCH_REWIND_FRAMES, BENCH_REWIND_BYTES);
+    if (ok && hasRing) {
+        int delivered = 0;
+        int stalls = 0;
+        uint64_t start = GetMonotonicNs();
+        for (int frame = 0; (int)session.simulatedTicks < ticks; frame++) {
+            while (delivered < ticks && arrival[delivered] <= frame) {
+                ConfirmRollbackInput(&session, UnpackInput(inputs[delivered]));
+                delivered++;
+            }
+            if (!AdvanceRollback(&session)) stalls++;
+        }
+        while (delivered < ticks) ConfirmRollbackInput(&session, UnpackInput(inputs[delivered++]));
+        uint64_t elapsed = GetMonotonicNs() - start;
+
+        PushSnapshot(&ring);
+        uint64_t pushNs = 0;
+        for (int t = 0; t < ticks; t++) {
+            StepGameTick(&reference, &referenceLevel, referenceStreaming, UnpackInput(inputs[t]));
+            uint64_t pushStart = GetMonotonicNs();
+            PushSnapshot(&ring);
+            pushNs += GetMonotonicNs() - pushStart;
+        }
+        uint32_t expected = HashWorld(&reference);
+        bool matched = HashWorld(&world) == expected;
+
+        size_t ringBytes = GetSnapshotRingBytes(&ring);
+        int rewound = RewindSnapshots(&ring, GetSnapshotRingCount(&ring) - 1);
+        for (int t = (int)reference.tick; t < ticks; t++) {
+            StepGameTick(&reference, &referenceLevel, referenceStreaming, UnpackInput(inputs[t]));
+        }
+        matched = matched && HashWorld(&reference) == expected;
+
+        uint8_t* image = malloc(layout.size);
+        uint64_t captureNs = 0, restoreNs = 0;
+        if (image != NULL) {
+            uint64_t t0 = GetMonotonicNs();
+            for (int i = 0; i < BENCH_SNAPSHOT_REPEATS; i++) CaptureSnapshot(&layout, image);
+            uint64_t t1 = GetMonotonicNs();
+            for (int i = 0; i < BENCH_SNAPSHOT_REPEATS; i++) RestoreSnapshot(&layout, image);
+            captureNs = (t1 - t0) / BENCH_SNAPSHOT_REPEATS;
+            restoreNs = (GetMonotonicNs() - t1) / BENCH_SNAPSHOT_REPEATS;
+            free(image);
+        }
+
+        printf("{\"benchmark\": \"rollback\", \"seed\": %u, \"ticks\": %d, \"delay\": %d, \"streaming\": %s,\n", seed, ticks, delay,
+            isStreaming ? "true" : "false");
+        printf(" \"snapshotBytes\": %zu, \"captureNs\": %llu, \"restoreNs\": %llu, \"nsPerTick\": %.1f,\n", layout.size,
+            (unsigned long long)captureNs, (unsigned long long)restoreNs, (double)elapsed / ticks);
+        printf(" \"rollbacks\": %llu, \"resimulatedTicks\": %llu, \"predictedTicks\": %llu, \"stalls\": %d,\n",
+            (unsigned long long)session.stats.rollbacks, (unsigned long long)session.stats.resimulatedTicks,
+            (unsigned long long)session.stats.predictedTicks, stalls);
+        printf(" \"rewindFrames\": %d, \"deltaBytesPerFrame\": %.1f, \"pushNs\": %.1f, \"matched\": %s}\n", rewound,
+            rewound > 0 ? (double)ringBytes / rewound : 0.0, (double)pushNs / ticks, matched ? "true" : "false");
+        ok = matched;
+    }
+    if (hasRing) FreeSnapshotRing(&ring);
+    FreeRollbackSession(&session);
+    FreeGameWorld(&reference, &referenceLevel, referenceStreaming);
+    FreeGameWorld(&world, &level, isStreaming);
+    free(inputs);
+    free(arrival);
+    return ok;
+}
+
+// Her tick ölenlerin yerine parkur boyunca rastgele patlamalar eklenir;
+// yalnızca güncelleme süresi ölçülür
+static bool RunParticleBenchmark(int target, int ticks, uint32_t seed) {
+    ParticleSystem system;
+    uint64_t* samples = malloc(sizeof(uint64_t) * ticks);
+    if (samples == NULL || !InitParticleSystem(&system, target, seed)) {
+        free(samples);
+        return false;
+    }
+    benchRng = seed;
+    double live = 0.0;
+    int effect = 0;
+    for (int tick = 0; tick < ticks; tick++) {
+        for (;;) {
+            Rectangle rect = { (float)RandomRange(&benchRng, GROUND_START_X, GROUND_START_X + GROUND_LENGTH), (float)RandomRange(&benchRng, 100, 600),
+                BLOCK_SIZE, BLOCK_SIZE };
+            if (system.count >= target || EmitParticles(&system, (ParticleEffect)(effect++ % PARTICLE_EFFECT_COUNT), rect) == 0) break;
+        }
+        live += system.count;
+        uint64_t start = GetMonotonicNs();
+        UpdateParticles(&system);
+        samples[tick] = GetMonotonicNs() - start;
+    }
+    TickStats stats = SummarizeTicks(samples, ticks);
+    double meanLive = live / ticks;
+    printf("{\"benchmark\": \"particles\", \"seed\": %u, \"ticks\": %d, \"capacity\": %d, \"meanLive\": %.0f,\n", seed, ticks,
+        target, meanLive);
+    printf(" \"nsPerUpdate\": %.1f, \"nsPerParticle\": %.3f, \"p50Ns\": %llu, \"p99Ns\": %llu, \"maxNs\": %llu}\n",
+        (double)stats.totalNs / ticks, meanLive > 0 ? (double)stats.totalNs / ticks / meanLive : 0.0,
+        (unsigned long long)stats.p50Ns, (unsigned long long)stats.p99Ns, (unsigned long long)stats.maxNs);
+    FreeParticleSystem(&system);
+    free(samples);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    int ticks = BENCH_DEFAULT_TICKS;
+    uint32_t seed = 12345;
+    int maxScale = 40000;
+    int threads = 1;
+    int batch = 0;
+    int repeat = 1;
+    int rollback = -1;
+    int particles = 0;
+    bool compareLod = false;
+    const char* replayPath = NULL;
+    const char* levelPath = NULL;
+    const char* resourceRoot = ".";
+    BenchLevel single = { 0 };
+    single.coinDensity = -1.0f;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (value == NULL) {
+            fprintf(stderr, "eksik deger: %s\n", arg);
+            return 1;
+        }
+        if (strcmp(arg, "--ticks") == 0) ticks = atoi(value);
+        else if (strcmp(arg, "--seed") == 0) seed = (uint32_t)strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--max-scale") == 0) maxScale = atoi(value);
+        else if (strcmp(arg, "--threads") == 0) threads = atoi(value);
+        else if (strcmp(arg, "--replay") == 0) replayPath = value;
+        else if (strcmp(arg, "--batch") == 0) batch = atoi(value);
+        else if (strcmp(arg, "--repeat") == 0) repeat = atoi(value);
+        else if (strcmp(arg, "--rollback") == 0) rollback = atoi(value);
+        else if (strcmp(arg, "--level") == 0) levelPath = value;
+        else if (strcmp(arg, "--particles") == 0) particles = atoi(value);
+        else if (strcmp(arg, "--lod") == 0) benchEnemyLod = atoi(value) != 0;
+        else if (strcmp(arg, "--chase") == 0) benchEnemyChase = atoi(value) != 0;
+        else if (strcmp(arg, "--compare-lod") == 0) compareLod = atoi(value) != 0;
+        else if (strcmp(arg, "--resources") == 0) resourceRoot = value;
+        else if (strcmp(arg, "--blocks") == 0) single.blockCount = atoi(value);
+        else if (strcmp(arg, "--enemies") == 0) single.enemyCount = atoi(value);
+        else if (strcmp(arg, "--coin-density") == 0) single.coinDensity = (float)atof(value);
+        else if (strcmp(arg, "--length") == 0) single.levelLength = atoi(value);
+        else {
+            fprintf(stderr, "bilinmeyen arguman: %s\n", arg);
+            return 1;
+        }
+        i++;
+    }
+    if (ticks < 1) ticks = 1;
+    if (seed == 0) seed = 1;
+
+    JobSystem jobSystem;
+    JobSystem* jobs = NULL;
+    if (threads > 1) {
+        if (!InitJobSystem(&jobSystem, threads - 1)) {
+            fprintf(stderr, "is sistemi baslatilamadi\n");
+            return 1;
+        }
+        jobs = &jobSystem;
+    }
+
+    if (replayPath != NULL) {
+        bool matched = RunReplayBenchmark(replayPath, resourceRoot, jobs);
+        if (jobs != NULL) FreeJobSystem(jobs);
+        return matched ? 0 : 2;
+    }
+    if (particles > 0) {
+        bool ok = RunParticleBenchmark(particles, ticks, seed);
+        if (jobs != NULL) FreeJobSystem(jobs);
+        if (!ok) fprintf(stderr, "bellek ayrilamadi\n");
+        return ok ? 0 : 1;
+    }
+    if (rollback >= 0) {
+        bool matched = RunRollbackBenchmark(rollback, ticks, seed, levelPath);
+        if (jobs != NULL) FreeJobSystem(jobs);
+        return matched ? 0 : 2;
+    }
+    if (compareLod) {
+        if (single.blockCount <= 0 && single.enemyCount <= 0 && single.levelLength <= 0) {
+            single.blockCount = MAX_BLOCKS * 100;
+            single.enemyCount = MAX_ENEMIES * 100;
+            single.levelLength = GROUND_LENGTH * 100;
+        }
+        if (single.levelLength <= 0) single.levelLength = GROUND_LENGTH;
+        if (single.coinDensity < 0) single.coinDensity = MAX_COINS * 1000.0f / GROUND_LENGTH;
+        bool matched = RunPatrolEdgeCheck(ticks);
+        matched = RunLodComparison(&single, ticks, seed, jobs) && matched;
+        if (jobs != NULL) FreeJobSystem(jobs);
+        return matched ? 0 : 2;
+    }
+    if (batch > 0) {
+        bool ok = RunBatchBenchmark(batch, ticks, repeat < 1 ? 1 : repeat, seed, jobs);
+        if (jobs != NULL) FreeJobSystem(jobs);
+        if (!ok) fprintf(stderr, "bellek ayrilamadi\n");
+        return ok ? 0 : 1;
+    }
+
+    printf("{\"benchmark\": \"stepworld\", \"seed\": %u, \"results\": [\n", seed);
+    bool ok = true;
+    if (single.blockCount > 0 || single.enemyCount > 0 || single.levelLength > 0) {
+        if (single.levelLength <= 0) single.levelLength = GROUND_LENGTH;
+        if (single.coinDensity < 0) single.coinDensity = MAX_COINS * 1000.0f / GROUND_LENGTH;
+        ok = RunBenchmark(&single, ticks, seed, jobs, true);
+    }
+    else {
+        // Oyunun sınırları (MAX_*, GROUND_LENGTH) x1'den başlar; uzunluk
+        // BENCH_MAX_LENGTH'te durur, sonrasında parkur yoğunlaşır.
+        for (int scale = 1; scale <= maxScale && ok; scale = (scale < 10000) ? scale * 10 : scale * 4) {
+            BenchLevel params;
+            params.blockCount = MAX_BLOCKS * scale;
+            params.enemyCount = MAX_ENEMIES * scale;
+            long long length = (long long)GROUND_LENGTH * scale;
+            params.levelLength = (int)(length < BENCH_MAX_LENGTH ? length : BENCH_MAX_LENGTH);
+            params.coinDensity = (float)((double)MAX_COINS * scale * 1000.0 / params.levelLength);
+            ok = RunBenchmark(&params, ticks, seed, jobs, scale == 1);
+        }
+    }
+    printf("\n]}\n");
+    if (jobs != NULL) FreeJobSystem(jobs);
+    if (!ok) fprintf(stderr, "bellek ayrilamadi\n");
+    return ok ? 0 : 1;
+}
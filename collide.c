@@ -0,0 +1,116 @@
+#include "collide.h"
+#include <math.h>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define COLLIDE_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define COLLIDE_SSE2 1
+#endif
+
+bool CheckCollision(Rectangle a, Rectangle b) {
+    return a.x < b.x + b.width &&
+        a.x + a.width > b.x &&
+        a.y < b.y + b.height &&
+        a.y + a.height > b.y;
+}
+
+// Monoton p(t) = p0 + v t + a t^2 / 2'nin target'a vardığı ilk t >= 0
+static double CrossingTime(double p0, double v, double a, double target) {
+    if (a == 0.0) return (target - p0) / v;
+    double disc = v * v + 2.0 * a * (target - p0);
+    double root = sqrt(disc > 0.0 ? disc : 0.0);
+    double r1 = (-v - root) / a, r2 = (-v + root) / a;
+    double lo = fmin(r1, r2), hi = fmax(r1, r2);
+    return lo >= 0.0 ? lo : hi;
+}
+
+// Tek eksende p(t) ∈ (lo, hi) olduğu açık zaman aralığı; boşsa false
+static bool SweepAxis(double p0, double v, double a, double duration, double lo, double hi, double* entry, double* exit) {
+    double p1 = p0 + v * duration + 0.5 * a * duration * duration;
+    if (p1 == p0) {
+        // Eksende hareket yok
+        *entry = -INFINITY;
+        *exit = INFINITY;
+        return p0 > lo && p0 < hi;
+    }
+    bool increasing = p1 > p0;
+    double enter = increasing ? lo : hi;
+    double leave = increasing ? hi : lo;
+    bool insideAtStart = p0 > lo && p0 < hi;
+    // Aralığa hiç girmiyor veya baştan geçmiş
+    if (!insideAtStart && (increasing ? (p1 <= lo || p0 >= hi) : (p1 >= hi || p0 <= lo))) return false;
+    *entry = insideAtStart ? -INFINITY : CrossingTime(p0, v, a, enter);
+    *exit = (increasing ? p1 < leave : p1 > leave) ? INFINITY : CrossingTime(p0, v, a, leave);
+    return true;
+}
+
+bool SweepCollision(Rectangle a, Vector2 velocity, Vector2 accel, float duration, Rectangle b, float* entry, float* exit) {
+    double xEntry, xExit, yEntry, yExit;
+    if (!SweepAxis(a.x, velocity.x, accel.x, duration, (double)b.x - a.width, (double)b.x + b.width, &xEntry, &xExit) ||
+        !SweepAxis(a.y, velocity.y, accel.y, duration, (double)b.y - a.height, (double)b.y + b.height, &yEntry, &yExit)) {
+        return false;
+    }
+    double first = fmax(xEntry, yEntry);
+    double last = fmin(xExit, yExit);
+    if (first >= last || first >= duration || last <= 0.0) return false;
+    *entry = (float)first;
+    *exit = (float)last;
+    return true;
+}
+
+static int PopCount(uint32_t v) {
+    int n = 0;
+    while (v) {
+        v &= v - 1;
+        n++;
+    }
+    return n;
+}
+
+int CheckCollisionBatch(Rectangle a, const float* x, const float* y, const float* width, const float* height,
+    int count, uint32_t* mask) {
+    for (int w = 0; w < (count + 31) / 32; w++) mask[w] = 0;
+
+    int i = 0;
+    float ax1 = a.x + a.width;
+    float ay1 = a.y + a.height;
+#if defined(COLLIDE_AVX)
+    __m256 vax0 = _mm256_set1_ps(a.x), vay0 = _mm256_set1_ps(a.y);
+    __m256 vax1 = _mm256_set1_ps(ax1), vay1 = _mm256_set1_ps(ay1);
+    for (; i + 8 <= count; i += 8) {
+        __m256 bx = _mm256_loadu_ps(x + i);
+        __m256 by = _mm256_loadu_ps(y + i);
+        __m256 bx1 = _mm256_add_ps(bx, _mm256_loadu_ps(width + i));
+        __m256 by1 = _mm256_add_ps(by, _mm256_loadu_ps(height + i));
+        __m256 hit = _mm256_and_ps(
+            _mm256_and_ps(_mm256_cmp_ps(vax0, bx1, _CMP_LT_OQ), _mm256_cmp_ps(vax1, bx, _CMP_GT_OQ)),
+            _mm256_and_ps(_mm256_cmp_ps(vay0, by1, _CMP_LT_OQ), _mm256_cmp_ps(vay1, by, _CMP_GT_OQ)));
+        mask[i >> 5] |= (uint32_t)_mm256_movemask_ps(hit) << (i & 31);
+    }
+#elif defined(COLLIDE_SSE2)
+    __m128 vax0 = _mm_set1_ps(a.x), vay0 = _mm_set1_ps(a.y);
+    __m128 vax1 = _mm_set1_ps(ax1), vay1 = _mm_set1_ps(ay1);
+    for (; i + 4 <= count; i += 4) {
+        __m128 bx = _mm_loadu_ps(x + i);
+        __m128 by = _mm_loadu_ps(y + i);
+        __m128 bx1 = _mm_add_ps(bx, _mm_loadu_ps(width + i));
+        __m128 by1 = _mm_add_ps(by, _mm_loadu_ps(height + i));
+        __m128 hit = _mm_and_ps(
+            _mm_and_ps(_mm_cmplt_ps(vax0, bx1), _mm_cmpgt_ps(vax1, bx)),
+            _mm_and_ps(_mm_cmplt_ps(vay0, by1), _mm_cmpgt_ps(vay1, by)));
+        mask[i >> 5] |= (uint32_t)_mm_movemask_ps(hit) << (i & 31);
+    }
+#endif
+    // Kalan elemanlar (ve SIMD olmayan derlemeler) için skaler yol
+    for (; i < count; i++) {
+        if (a.x < x[i] + width[i] && ax1 > x[i] && a.y < y[i] + height[i] && ay1 > y[i]) {
+            mask[i >> 5] |= 1u << (i & 31);
+        }
+    }
+
+    int hits = 0;
+    for (int w = 0; w < (count + 31) / 32; w++) hits += PopCount(mask[w]);
+    return hits;
+}
@@ -0,0 +1,30 @@
+#ifndef COLLIDE_H
+#define COLLIDE_H
+
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Toplu testlerde bir seferde toplanan aday sayısı (tek uint32_t maske)
+#define COLLIDE_BATCH 16
+
+bool CheckCollision(Rectangle a, Rectangle b);
+
+// Süpürülmüş AABB: a'nın sol üst köşesi t anında
+// p(t) = (a.x, a.y) + velocity * t + accel * t^2 / 2 iken, t ∈ [0, duration]
+// içinde b ile CheckCollision anlamında (açık aralık) kesiştiği zamanlar
+// (*entry, *exit) açık aralığıdır. Başta kesişiyorsa *entry -INFINITY,
+// sona kadar sürüyorsa *exit INFINITY olur. Hareket her eksende
+// [0, duration] boyunca monoton olmalıdır (tepe noktasında bölün).
+// Bu aralıkta kesişme yoksa false döner.
+bool SweepCollision(Rectangle a, Vector2 velocity, Vector2 accel, float duration, Rectangle b, float* entry, float* exit);
+
+// a'yı x/y/width/height dizilerindeki count dikdörtgene karşı test eder.
+// i. dikdörtgen çakışıyorsa mask'in i. biti set edilir (mask en az
+// (count + 31) / 32 kelime olmalı); çakışan dikdörtgen sayısını döner.
+// Derleyici AVX destekliyorsa 8'li, yoksa SSE2 ile 4'lü gruplar işlenir;
+// sonuçlar CheckCollision ile birebir aynıdır.
+int CheckCollisionBatch(Rectangle a, const float* x, const float* y, const float* width, const float* height,
+    int count, uint32_t* mask);
+
+#endif
@@ -0,0 +1,185 @@
+#include "entities.h"
+#include <stdlib.h>
+#include <string.h>
+
+bool InitBlockSet(BlockSet* set, int capacity) {
+    memset(set, 0, sizeof(*set));
+    int n = capacity > 0 ? capacity : 1;
+    // Boş yuvalar ClearBlock'ta eski alanları kayda düşerken okunur; sıfırla başlar
+    set->x = calloc(n, sizeof(float));
+    set->y = calloc(n, sizeof(float));
+    set->width = calloc(n, sizeof(float));
+    set->height = calloc(n, sizeof(float));
+    set->sprite = malloc(n * sizeof(uint8_t));
+    set->stone = calloc(FLAG_WORDS(n), sizeof(uint32_t));
+    set->hasCoin = calloc(FLAG_WORDS(n), sizeof(uint32_t));
+    set->hit = calloc(FLAG_WORDS(n), sizeof(uint32_t));
+    set->changed = malloc(BLOCK_CHANGE_LOG * sizeof(Rectangle));
+    if (set->x == NULL || set->y == NULL || set->width == NULL || set->height == NULL || set->sprite == NULL ||
+        set->stone == NULL || set->hasCoin == NULL || set->hit == NULL || set->changed == NULL) {
+        FreeBlockSet(set);
+        return false;
+    }
+    set->capacity = capacity;
+    return true;
+}
+
+void FreeBlockSet(BlockSet* set) {
+    free(set->x);
+    free(set->y);
+    free(set->width);
+    free(set->height);
+    free(set->sprite);
+    free(set->stone);
+    free(set->hasCoin);
+    free(set->hit);
+    free(set->changed);
+    memset(set, 0, sizeof(*set));
+}
+
+bool InitEnemySet(EnemySet* set, int capacity) {
+    memset(set, 0, sizeof(*set));
+    int n = capacity > 0 ? capacity : 1;
+    set->x = malloc(n * sizeof(float));
+    set->y = malloc(n * sizeof(float));
+    set->width = malloc(n * sizeof(float));
+    set->height = malloc(n * sizeof(float));
+    set->speed = malloc(n * sizeof(float));
+    set->velocityY = calloc(n, sizeof(float));
+    set->direction = malloc(n * sizeof(int8_t));
+    set->sprite = malloc(n * sizeof(uint8_t));
+    set->active = calloc(FLAG_WORDS(n), sizeof(uint32_t));
+    set->lastTick = calloc(n, sizeof(uint32_t));
+    set->wakeTick = calloc(n, sizeof(uint32_t));
+    if (set->x == NULL || set->y == NULL || set->width == NULL || set->height == NULL || set->speed == NULL ||
+        set->velocityY == NULL || set->direction == NULL || set->sprite == NULL || set->active == NULL || set->lastTick == NULL ||
+        set->wakeTick == NULL) {
+        FreeEnemySet(set);
+        return false;
+    }
+    set->capacity = capacity;
+    return true;
+}
+
+void FreeEnemySet(EnemySet* set) {
+    free(set->x);
+    free(set->y);
+    free(set->width);
+    free(set->height);
+    free(set->speed);
+    free(set->velocityY);
+    free(set->direction);
+    free(set->sprite);
+    free(set->active);
+    free(set->lastTick);
+    free(set->wakeTick);
+    memset(set, 0, sizeof(*set));
+}
+
+bool InitCoinSet(CoinSet* set, int capacity) {
+    memset(set, 0, sizeof(*set));
+    int n = capacity > 0 ? capacity : 1;
+    set->x = malloc(n * sizeof(float));
+    set->y = malloc(n * sizeof(float));
+    set->width = malloc(n * sizeof(float));
+    set->height = malloc(n * sizeof(float));
+    set->sprite = malloc(n * sizeof(uint8_t));
+    set->collected = calloc(FLAG_WORDS(n), sizeof(uint32_t));
+    if (set->x == NULL || set->y == NULL || set->width == NULL || set->height == NULL || set->sprite == NULL ||
+        set->collected == NULL) {
+        FreeCoinSet(set);
+        return false;
+    }
+    set->capacity = capacity;
+    return true;
+}
+
+void FreeCoinSet(CoinSet* set) {
+    free(set->x);
+    free(set->y);
+    free(set->width);
+    free(set->height);
+    free(set->sprite);
+    free(set->collected);
+    memset(set, 0, sizeof(*set));
+}
+
+void PutBlock(BlockSet* set, int i, Rectangle rect, BlockType type, bool hasCoin) {
+    set->x[i] = rect.x;
+    set->y[i] = rect.y;
+    set->width[i] = rect.width;
+    set->height[i] = rect.height;
+    set->sprite[i] = (type == BLOCK_QUESTION) ? SPRITE_QUESTION_BLOCK : SPRITE_STONE_BLOCK;
+    SetFlag(set->stone, i, type == BLOCK_STONE);
+    SetFlag(set->hasCoin, i, hasCoin);
+    SetFlag(set->hit, i, false);
+    if (rect.width != 0) MarkBlockChanged(set, rect);
+}
+
+void PutEnemy(EnemySet* set, int i, Rectangle rect, int direction, float speed) {
+    set->x[i] = rect.x;
+    set->y[i] = rect.y;
+    set->width[i] = rect.width;
+    set->height[i] = rect.height;
+    set->speed[i] = speed;
+    set->velocityY[i] = 0.0f;
+    set->direction[i] = (int8_t)direction;
+    set->sprite[i] = SPRITE_ENEMY;
+    SetFlag(set->active, i, true);
+    // Parkurun başından beri devriyede sayılır; uyanınca oraya kadar ilerletilir
+    set->lastTick[i] = 0;
+    set->wakeTick[i] = 0;
+}
+
+void PutCoin(CoinSet* set, int i, Rectangle rect) {
+    set->x[i] = rect.x;
+    set->y[i] = rect.y;
+    set->width[i] = rect.width;
+    set->height[i] = rect.height;
+    set->sprite[i] = SPRITE_COIN;
+    SetFlag(set->collected, i, false);
+}
+
+void MarkBlockChanged(BlockSet* set, Rectangle rect) {
+    if (set->changed == NULL || set->changedCount > BLOCK_CHANGE_LOG) return;
+    if (set->changedCount < BLOCK_CHANGE_LOG) set->changed[set->changedCount] = rect;
+    set->changedCount++;
+}
+
+void ClearBlock(BlockSet* set, int i) {
+    if (set->width[i] != 0) MarkBlockChanged(set, GetBlockRect(set, i));
+    PutBlock(set, i, (Rectangle){ 0, 0, 0, 0 }, BLOCK_QUESTION, false);
+    set->sprite[i] = SPRITE_NONE;
+}
+
+void ClearEnemy(EnemySet* set, int i) {
+    PutEnemy(set, i, (Rectangle){ 0, 0, 0, 0 }, 1, 0.0f);
+    set->sprite[i] = SPRITE_NONE;
+    SetFlag(set->active, i, false);
+}
+
+void ClearCoin(CoinSet* set, int i) {
+    PutCoin(set, i, (Rectangle){ 0, 0, 0, 0 });
+    set->sprite[i] = SPRITE_NONE;
+}
+
+int AddBlock(BlockSet* set, Rectangle rect, BlockType type, bool hasCoin) {
+    if (set->count >= set->capacity) return -1;
+    int i = set->count++;
+    PutBlock(set, i, rect, type, hasCoin);
+    return i;
+}
+
+int AddEnemy(EnemySet* set, Rectangle rect, int direction, float speed) {
+    if (set->count >= set->capacity) return -1;
+    int i = set->count++;
+    PutEnemy(set, i, rect, direction, speed);
+    return i;
+}
+
+int AddCoin(CoinSet* set, Rectangle rect) {
+    if (set->count >= set->capacity) return -1;
+    int i = set->count++;
+    PutCoin(set, i, rect);
+    return i;
+}
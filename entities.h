@@ -0,0 +1,128 @@
+#ifndef ENTITIES_H
+#define ENTITIES_H
+
+// Parkur elemanları için structure-of-arrays depolama. Çarpışma döngüleri
+// yalnızca x/y/width/height dizilerine dokunur; bool bayraklar 32'lik
+// bitset'lerde, dokular ise küçük bir sprite kimliği olarak tutulur.
+
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum BlockType {
+    BLOCK_QUESTION,
+    BLOCK_STONE
+} BlockType;
+
+// Çizim tarafında atlas bölgesine indeks olarak kullanılır
+typedef enum SpriteId {
+    SPRITE_NONE,
+    SPRITE_QUESTION_BLOCK,
+    SPRITE_STONE_BLOCK,
+    SPRITE_COIN,
+    SPRITE_ENEMY,
+    // Yalnızca çizimde kullanılanlar
+    SPRITE_MARIO_WALK1,
+    SPRITE_MARIO_WALK2,
+    SPRITE_MARIO_WALK3,
+    SPRITE_MARIO_JUMP,
+    SPRITE_MARIO_IDLE,
+    SPRITE_CLOUD,
+    SPRITE_COUNT
+} SpriteId;
+
+typedef struct {
+    float* x;
+    float* y;
+    float* width;
+    float* height;
+    uint8_t* sprite;
+    uint32_t* stone;    // Bit set ise BLOCK_STONE, değilse BLOCK_QUESTION
+    uint32_t* hasCoin;
+    uint32_t* hit;
+    Rectangle* changed; // Görünümü değişen blok alanları (çizim önbelleği için), NULL ise tutulmaz
+    int changedCount;   // BLOCK_CHANGE_LOG'u aşarsa BLOCK_CHANGE_LOG + 1'de kalır: tüm parkur değişmiş say
+    int count;
+    int capacity;
+} BlockSet;
+
+typedef struct {
+    float* x;
+    float* y;
+    float* width;
+    float* height;
+    float* speed;
+    float* velocityY;   // Yalnızca kovalayan düşmanlar düşer ve zıplar
+    int8_t* direction;
+    uint8_t* sprite;
+    uint32_t* active;
+    uint32_t* lastTick; // Konumun güncel olduğu son tick (uzaktaki düşmanlar seyrek güncellenir)
+    uint32_t* wakeTick; // Sıradaki güncellemenin tick'i; geçmişte kalmışsa ilk fırsatta
+    int count;
+    int capacity;
+} EnemySet;
+
+typedef struct {
+    float* x;
+    float* y;
+    float* width;
+    float* height;
+    uint8_t* sprite;
+    uint32_t* collected;
+    int count;
+    int capacity;
+} CoinSet;
+
+#define FLAG_WORDS(n) (((n) + 31) / 32)
+#define BLOCK_CHANGE_LOG 256
+
+static inline bool GetFlag(const uint32_t* bits, int i) {
+    return (bits[i >> 5] >> (i & 31)) & 1u;
+}
+
+static inline void SetFlag(uint32_t* bits, int i, bool value) {
+    if (value) bits[i >> 5] |= 1u << (i & 31);
+    else bits[i >> 5] &= ~(1u << (i & 31));
+}
+
+bool InitBlockSet(BlockSet* set, int capacity);
+void FreeBlockSet(BlockSet* set);
+bool InitEnemySet(EnemySet* set, int capacity);
+void FreeEnemySet(EnemySet* set);
+bool InitCoinSet(CoinSet* set, int capacity);
+void FreeCoinSet(CoinSet* set);
+
+// i. yuvaya eleman yazar / yuvayı boşaltır (genişlik 0 ve bayraklar kapalı).
+void PutBlock(BlockSet* set, int i, Rectangle rect, BlockType type, bool hasCoin);
+void PutEnemy(EnemySet* set, int i, Rectangle rect, int direction, float speed);
+void PutCoin(CoinSet* set, int i, Rectangle rect);
+void ClearBlock(BlockSet* set, int i);
+void ClearEnemy(EnemySet* set, int i);
+void ClearCoin(CoinSet* set, int i);
+
+// Bloğun çizimini etkileyen değişiklikler (ekleme, boşaltma, vurulma) bu
+// kayda düşer; çizim tarafı okuyup changedCount'u sıfırlar.
+void MarkBlockChanged(BlockSet* set, Rectangle rect);
+
+// Eleman ekler ve indeksini döner; kapasite doluysa -1.
+int AddBlock(BlockSet* set, Rectangle rect, BlockType type, bool hasCoin);
+int AddEnemy(EnemySet* set, Rectangle rect, int direction, float speed);
+int AddCoin(CoinSet* set, Rectangle rect);
+
+static inline BlockType GetBlockType(const BlockSet* set, int i) {
+    return GetFlag(set->stone, i) ? BLOCK_STONE : BLOCK_QUESTION;
+}
+
+static inline Rectangle GetBlockRect(const BlockSet* set, int i) {
+    return (Rectangle){ set->x[i], set->y[i], set->width[i], set->height[i] };
+}
+
+static inline Rectangle GetEnemyRect(const EnemySet* set, int i) {
+    return (Rectangle){ set->x[i], set->y[i], set->width[i], set->height[i] };
+}
+
+static inline Rectangle GetCoinRect(const CoinSet* set, int i) {
+    return (Rectangle){ set->x[i], set->y[i], set->width[i], set->height[i] };
+}
+
+#endif
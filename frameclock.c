@@ -0,0 +1,100 @@
+#include "frameclock.h"
+#include <math.h>
+#include <string.h>
+
+static void PushSample(float* ring, int* count, uint64_t ns) {
+    ring[*count % FRAME_TIMING_HISTORY] = (float)((double)ns / 1e6);
+    (*count)++;
+}
+
+// Halkadaki örneklerin ortalaması, standart sapması ve en büyüğü
+static void Summarize(const float* ring, int count, float* mean, float* deviation, float* max) {
+    int n = count < FRAME_TIMING_HISTORY ? count : FRAME_TIMING_HISTORY;
+    double sum = 0.0, squares = 0.0;
+    float largest = 0.0f;
+    for (int i = 0; i < n; i++) {
+        sum += ring[i];
+        squares += (double)ring[i] * ring[i];
+        if (ring[i] > largest) largest = ring[i];
+    }
+    double average = n > 0 ? sum / n : 0.0;
+    double variance = n > 0 ? squares / n - average * average : 0.0;
+    *mean = (float)average;
+    if (deviation != NULL) *deviation = variance > 0.0 ? (float)sqrt(variance) : 0.0f;
+    if (max != NULL) *max = largest;
+}
+
+void InitFrameClock(FrameClock* clock, uint64_t now) {
+    memset(clock, 0, sizeof(*clock));
+    clock->frameNs = now;
+}
+
+int BeginFrameTicks(FrameClock* clock, uint64_t now) {
+    PushSample(clock->frameMs, &clock->frameCount, now - clock->frameNs);
+    clock->accumulator += now - clock->frameNs;
+    clock->frameNs = now;
+
+    uint64_t ticks = clock->accumulator / FIXED_TICK_NS;
+    if (ticks > FRAME_MAX_TICKS) {
+        // Takılan bir kareden sonra (pencere sürükleme, hata ayıklayıcı) oyun
+        // geri kalanı yetiştirmeye çalışmaz; aksi halde her kare bir öncekinden uzun sürer
+        clock->droppedTicks += ticks - FRAME_MAX_TICKS;
+        clock->accumulator -= (ticks - FRAME_MAX_TICKS) * FIXED_TICK_NS;
+        ticks = FRAME_MAX_TICKS;
+    }
+    clock->accumulator -= ticks * FIXED_TICK_NS;
+    // İlk tick'in zamanı, biriktiricinin onun eşiğini geçtiği andır
+    if (ticks > 0) clock->tickDueNs = now - clock->accumulator - (ticks - 1) * FIXED_TICK_NS;
+    return (int)ticks;
+}
+
+void HoldFrameClock(FrameClock* clock, uint64_t now) {
+    PushSample(clock->frameMs, &clock->frameCount, now - clock->frameNs);
+    clock->frameNs = now;
+    // Duraklamanın süresi tick aralığına, menüde basılan tuşlar gecikmeye sayılmaz
+    clock->lastTickNs = 0;
+    clock->inputNs = 0;
+}
+
+void BeginFrameTick(FrameClock* clock, uint64_t now) {
+    PushSample(clock->tickLateMs, &clock->tickCount, now > clock->tickDueNs ? now - clock->tickDueNs : 0);
+    // Aralık halkası gecikmeyle aynı sayacı kullanır; ilk tick'te aralık yoktur
+    clock->tickMs[(clock->tickCount - 1) % FRAME_TIMING_HISTORY] =
+        clock->lastTickNs != 0 ? (float)((double)(now - clock->lastTickNs) / 1e6) : 1000.0f / FIXED_TICK_RATE;
+    clock->lastTickNs = now;
+    clock->tickDueNs += FIXED_TICK_NS;
+    clock->ticks++;
+    if (clock->inputNs != 0) clock->inputTicked = true;
+}
+
+float GetFrameAlpha(const FrameClock* clock) {
+    return (float)((double)clock->accumulator / FIXED_TICK_NS);
+}
+
+void SampleFrameInput(FrameClock* clock, uint32_t bits) {
+    if (bits != clock->inputBits && clock->inputNs == 0 && clock->presentNs != 0) {
+        clock->inputNs = clock->presentNs;
+        clock->inputTicked = false;
+    }
+    clock->inputBits = bits;
+}
+
+void EndFrameClock(FrameClock* clock, uint64_t now) {
+    if (clock->inputNs != 0 && clock->inputTicked) {
+        PushSample(clock->inputLatencyMs, &clock->inputCount, now - clock->inputNs);
+        clock->inputNs = 0;
+        clock->inputTicked = false;
+    }
+    clock->presentNs = now;
+}
+
+void GetFrameTimingStats(const FrameClock* clock, FrameTimingStats* stats) {
+    memset(stats, 0, sizeof(*stats));
+    Summarize(clock->frameMs, clock->frameCount, &stats->frameMs, &stats->frameJitterMs, &stats->frameMaxMs);
+    Summarize(clock->tickMs, clock->tickCount, &stats->tickMs, &stats->tickJitterMs, NULL);
+    Summarize(clock->tickLateMs, clock->tickCount, &stats->tickLateMs, NULL, &stats->tickLateMaxMs);
+    Summarize(clock->inputLatencyMs, clock->inputCount, &stats->inputLatencyMs, NULL, &stats->inputLatencyMaxMs);
+    stats->inputSamples = clock->inputCount < FRAME_TIMING_HISTORY ? clock->inputCount : FRAME_TIMING_HISTORY;
+    stats->ticks = clock->ticks;
+    stats->droppedTicks = clock->droppedTicks;
+}
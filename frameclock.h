@@ -0,0 +1,84 @@
+#ifndef FRAMECLOCK_H
+#define FRAMECLOCK_H
+
+// Sabit adımlı simülasyon saati. Oyun mantığı kare hızından bağımsız
+// olarak saniyede FIXED_TICK_RATE tick ilerler: her karede geçen gerçek
+// süre biriktiriciye eklenir ve içinde kaç tam tick varsa o kadar tick
+// çalıştırılır. Artan kesir, çizimde son iki tick arasındaki ara değerin
+// oranıdır (GetFrameAlpha). Yavaş bir kare oyunu yavaşlatmaz, yüksek
+// yenileme hızlı ekranlarda oyun hızlanmaz.
+//
+// Saat ayrıca kare ve tick zamanlamasını ölçer: kare aralığı ve sapması,
+// tick'lerin gerçek zamandaki aralığı ve gecikmesi, girdinin okunmasından
+// etkisinin ekrana gönderilmesine kadar geçen süre.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define FIXED_TICK_RATE 60
+#define FIXED_TICK_NS (1000000000ull / FIXED_TICK_RATE)
+#define FRAME_MAX_TICKS 8        // Uzun bir karenin ardından en fazla bu kadar tick yetiştirilir
+#define FRAME_TIMING_HISTORY 240 // İstatistiklerin hesaplandığı son örnek sayısı
+
+// Son FRAME_TIMING_HISTORY örnek üzerinden, milisaniye
+typedef struct {
+    float frameMs;       // Ortalama kare aralığı
+    float frameJitterMs; // Kare aralığının standart sapması
+    float frameMaxMs;
+    float tickMs;        // Tick'lerin gerçek zamanda ortalama aralığı (ideali 1000 / FIXED_TICK_RATE)
+    float tickJitterMs;  // Tick aralığının standart sapması
+    float tickLateMs;    // Tick'in zamanı geldikten sonra ne kadar geç çalıştığı, ortalama
+    float tickLateMaxMs;
+    float inputLatencyMs; // Girdinin okunmasından onu işleyen tick'in karesi gönderilene kadar
+    float inputLatencyMaxMs;
+    int inputSamples;     // inputLatency'nin dayandığı örnek sayısı
+    uint64_t ticks;
+    uint64_t droppedTicks; // FRAME_MAX_TICKS sınırı yüzünden atlanan tick
+} FrameTimingStats;
+
+typedef struct {
+    uint64_t frameNs;       // Son karenin başladığı an (GetMonotonicNs)
+    uint64_t accumulator;   // Henüz tick'e dönüşmemiş süre
+    uint64_t tickDueNs;     // Sıradaki tick'in zamanının geldiği an
+    uint64_t lastTickNs;
+    uint64_t presentNs;     // Son karenin ekrana gönderildiği (EndDrawing'in döndüğü) an
+    uint64_t ticks;
+    uint64_t droppedTicks;
+
+    // Girdi gecikmesi: değişen girdinin okunduğu an, onu bir tick işleyince
+    // kare sonunda ölçülür
+    uint32_t inputBits;
+    uint64_t inputNs;  // Bekleyen ölçüm yoksa 0
+    bool inputTicked;
+
+    float frameMs[FRAME_TIMING_HISTORY];
+    float tickMs[FRAME_TIMING_HISTORY];
+    float tickLateMs[FRAME_TIMING_HISTORY];
+    float inputLatencyMs[FRAME_TIMING_HISTORY];
+    int frameCount, tickCount, inputCount; // Yazılan örnek (halka dolunca da artar)
+} FrameClock;
+
+void InitFrameClock(FrameClock* clock, uint64_t now);
+// Kare başında çağrılır; bu karede çalıştırılacak tick sayısını döner.
+int BeginFrameTicks(FrameClock* clock, uint64_t now);
+// Oyun duraklatılmışken kare başında BeginFrameTicks yerine çağrılır:
+// geçen süre biriktiriciye eklenmez.
+void HoldFrameClock(FrameClock* clock, uint64_t now);
+// Her tick çalışmadan hemen önce çağrılır.
+void BeginFrameTick(FrameClock* clock, uint64_t now);
+// Son tick'ten sonraki kesir, [0, 1). Çizim önceki ve son tick'in
+// durumları arasında bu oranda ara değer alır.
+float GetFrameAlpha(const FrameClock* clock);
+
+// Karede okunan girdi, bit başına bir basılı tuş. Önceki kareden farklıysa
+// ve bekleyen ölçüm yoksa gecikme ölçümü başlar. raylib girdiyi bir önceki
+// karenin EndDrawing'inin sonunda okuduğu için okuma anı presentNs sayılır.
+void SampleFrameInput(FrameClock* clock, uint32_t bits);
+// EndDrawing döndükten sonra çağrılır. Ölçülen gecikme EndDrawing'in
+// dönüşüne kadardır: SetTargetFPS beklemesi dahil, ekranın taranması ve
+// kompozitörün payı hariç.
+void EndFrameClock(FrameClock* clock, uint64_t now);
+
+void GetFrameTimingStats(const FrameClock* clock, FrameTimingStats* stats);
+
+#endif
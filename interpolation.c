@@ -0,0 +1,73 @@
+#include "interpolation.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+bool InitRenderInterpolation(RenderInterpolation* lerp, int enemyCapacity) {
+    memset(lerp, 0, sizeof(*lerp));
+    int n = enemyCapacity > 0 ? enemyCapacity : 1;
+    lerp->enemyX = malloc(n * sizeof(float));
+    lerp->enemyY = malloc(n * sizeof(float));
+    lerp->enemyActive = calloc(FLAG_WORDS(n), sizeof(uint32_t));
+    lerp->drawX = malloc(n * sizeof(float));
+    lerp->drawY = malloc(n * sizeof(float));
+    if (lerp->enemyX == NULL || lerp->enemyY == NULL || lerp->enemyActive == NULL || lerp->drawX == NULL || lerp->drawY == NULL) {
+        FreeRenderInterpolation(lerp);
+        return false;
+    }
+    lerp->capacity = enemyCapacity;
+    return true;
+}
+
+void FreeRenderInterpolation(RenderInterpolation* lerp) {
+    free(lerp->enemyX);
+    free(lerp->enemyY);
+    free(lerp->enemyActive);
+    free(lerp->drawX);
+    free(lerp->drawY);
+    memset(lerp, 0, sizeof(*lerp));
+}
+
+void CaptureRenderState(RenderInterpolation* lerp, const World* world) {
+    const EnemySet* enemies = &world->enemies;
+    int count = enemies->count < lerp->capacity ? enemies->count : lerp->capacity;
+    lerp->mario = world->marioPosition;
+    memcpy(lerp->enemyX, enemies->x, count * sizeof(float));
+    memcpy(lerp->enemyY, enemies->y, count * sizeof(float));
+    memcpy(lerp->enemyActive, enemies->active, FLAG_WORDS(count) * sizeof(uint32_t));
+}
+
+static float Lerp1(float previous, float current, float alpha) {
+    float delta = current - previous;
+    return fabsf(delta) > INTERP_SNAP_DISTANCE ? current : previous + delta * alpha;
+}
+
+Vector2 InterpolateWorld(RenderInterpolation* lerp, const World* world, float alpha) {
+    const EnemySet* enemies = &world->enemies;
+    int count = enemies->count < lerp->capacity ? enemies->count : lerp->capacity;
+    const float* x = enemies->x;
+    const float* y = enemies->y;
+    const float* previousX = lerp->enemyX;
+    const float* previousY = lerp->enemyY;
+    float* drawX = lerp->drawX;
+    float* drawY = lerp->drawY;
+
+    for (int i = 0; i < count; i++) {
+        drawX[i] = Lerp1(previousX[i], x[i], alpha);
+        drawY[i] = Lerp1(previousY[i], y[i], alpha);
+    }
+    // Önceki tick'te etkin olmayan yuvaların saklı konumu eskidir
+    for (int w = 0; w < FLAG_WORDS(count); w++) {
+        uint32_t fresh = enemies->active[w] & ~lerp->enemyActive[w];
+        for (int b = 0; fresh != 0; b++, fresh >>= 1) {
+            int i = w * 32 + b;
+            if (!(fresh & 1u)) continue;
+            if (i >= count) break;
+            drawX[i] = x[i];
+            drawY[i] = y[i];
+        }
+    }
+
+    Vector2 mario = world->marioPosition;
+    return (Vector2){ Lerp1(lerp->mario.x, mario.x, alpha), Lerp1(lerp->mario.y, mario.y, alpha) };
+}
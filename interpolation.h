@@ -0,0 +1,39 @@
+#ifndef INTERPOLATION_H
+#define INTERPOLATION_H
+
+// Çizim için son iki tick'in durumu arasında ara değer. Her karenin son
+// tick'inden önce Mario'nun ve düşmanların konumu saklanır; çizimde
+// saklanan ile güncel konum arasında GetFrameAlpha oranında ara değer
+// alınır. Böylece tick'lerin kare hızından bağımsız olduğu durumda da
+// hareket her karede akıcıdır. Görüntü en fazla bir tick geriden gelir.
+//
+// Bir tick'te INTERP_SNAP_DISTANCE'tan fazla yer değiştiren (akışlı
+// parkurda yuvası yeniden kullanılan, hızlı yüklemeyle taşınan) ya da o
+// tick'te etkinleşen eleman ara değersiz çizilir.
+
+#include "raylib.h"
+#include "world.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define INTERP_SNAP_DISTANCE (2 * BLOCK_SIZE)
+
+typedef struct {
+    Vector2 mario; // Önceki tick
+    float* enemyX;
+    float* enemyY;
+    uint32_t* enemyActive;
+    float* drawX;  // InterpolateWorld'ün çıktısı, düşman indeksine göre
+    float* drawY;
+    int capacity;
+} RenderInterpolation;
+
+bool InitRenderInterpolation(RenderInterpolation* lerp, int enemyCapacity);
+void FreeRenderInterpolation(RenderInterpolation* lerp);
+
+// Tick'ten önce çağrılır; karede birden çok tick çalışıyorsa sonuncusundan önce yeterlidir.
+void CaptureRenderState(RenderInterpolation* lerp, const World* world);
+// Mario'nun çizim konumunu döner, düşmanlarınkini drawX/drawY'ye yazar.
+Vector2 InterpolateWorld(RenderInterpolation* lerp, const World* world, float alpha);
+
+#endif
@@ -0,0 +1,171 @@
+#include "jobs.h"
+#include "profiler.h"
+#include <stdlib.h>
+
+static bool PopJob(JobQueue* queue, Job* job) {
+    bool found = false;
+    LockMutex(&queue->mutex);
+    if (queue->tail != queue->head) {
+        queue->tail--;
+        *job = queue->jobs[queue->tail % JOB_QUEUE_CAPACITY];
+        found = true;
+    }
+    UnlockMutex(&queue->mutex);
+    return found;
+}
+
+static bool StealJob(JobSystem* system, int self, Job* job) {
+    int queueCount = system->workerCount + 1;
+    for (int k = 1; k < queueCount; k++) {
+        JobQueue* queue = &system->queues[(self + k) % queueCount];
+        bool found = false;
+        LockMutex(&queue->mutex);
+        if (queue->tail != queue->head) {
+            *job = queue->jobs[queue->head % JOB_QUEUE_CAPACITY];
+            queue->head++;
+            found = true;
+        }
+        UnlockMutex(&queue->mutex);
+        if (found) return true;
+    }
+    return false;
+}
+
+// Kendi kuyruğu ve çalınabilecek iş kalmayana kadar parça çalıştırır
+static void RunJobs(JobSystem* system, int self) {
+    Job job;
+    while (PopJob(&system->queues[self], &job) || StealJob(system, self, &job)) {
+        PROFILE_BEGIN(PROFILE_JOB);
+        job.func(job.data, job.begin, job.end);
+        PROFILE_END(PROFILE_JOB);
+        if (AtomicAdd(&system->pending, -1) == 0) {
+            LockMutex(&system->mutex);
+            BroadcastCondition(&system->done);
+            UnlockMutex(&system->mutex);
+        }
+    }
+}
+
+static int JobWorkerMain(void* arg) {
+    JobWorker* worker = arg;
+    JobSystem* system = worker->system;
+    for (;;) {
+        LockMutex(&system->mutex);
+        while (!system->quit && AtomicLoad(&system->pending) == 0) WaitCondition(&system->wake, &system->mutex);
+        bool quit = system->quit;
+        UnlockMutex(&system->mutex);
+        if (quit) break;
+
+        RunJobs(system, worker->index);
+        // Kalan parçalar başka iş parçacıklarında sürüyor
+        YieldThread();
+    }
+    return 0;
+}
+
+bool InitJobSystem(JobSystem* system, int workerCount) {
+    system->queues = NULL;
+    system->workerCount = 0;
+    system->pending = 0;
+    system->quit = false;
+
+    if (workerCount <= 0) workerCount = GetCpuCount() - 1;
+    if (workerCount > JOB_MAX_WORKERS) workerCount = JOB_MAX_WORKERS;
+    if (workerCount < 0) workerCount = 0;
+
+    system->queues = calloc(workerCount + 1, sizeof(JobQueue));
+    if (system->queues == NULL) return false;
+    int queueCount = 0;
+    for (; queueCount < workerCount + 1; queueCount++) {
+        if (!InitMutex(&system->queues[queueCount].mutex)) break;
+    }
+    bool ok = queueCount == workerCount + 1 && InitMutex(&system->mutex);
+    if (ok && !InitCondition(&system->wake)) {
+        DestroyMutex(&system->mutex);
+        ok = false;
+    }
+    if (ok && !InitCondition(&system->done)) {
+        DestroyCondition(&system->wake);
+        DestroyMutex(&system->mutex);
+        ok = false;
+    }
+    if (!ok) {
+        for (int i = 0; i < queueCount; i++) DestroyMutex(&system->queues[i].mutex);
+        free(system->queues);
+        system->queues = NULL;
+        return false;
+    }
+
+    // Açılamayan işçiler olursa daha az iş parçacığıyla devam edilir
+    for (int i = 0; i < workerCount; i++) {
+        system->workerArgs[i].system = system;
+        system->workerArgs[i].index = i + 1;
+        if (!StartThread(&system->workers[i], JobWorkerMain, &system->workerArgs[i])) break;
+        system->workerCount++;
+    }
+    for (int i = system->workerCount + 1; i < workerCount + 1; i++) DestroyMutex(&system->queues[i].mutex);
+    return true;
+}
+
+void FreeJobSystem(JobSystem* system) {
+    if (system->queues == NULL) return;
+    LockMutex(&system->mutex);
+    system->quit = true;
+    BroadcastCondition(&system->wake);
+    UnlockMutex(&system->mutex);
+    for (int i = 0; i < system->workerCount; i++) JoinThread(&system->workers[i]);
+
+    int queueCount = system->workerCount + 1;
+    for (int i = 0; i < queueCount; i++) DestroyMutex(&system->queues[i].mutex);
+    DestroyCondition(&system->done);
+    DestroyCondition(&system->wake);
+    DestroyMutex(&system->mutex);
+    free(system->queues);
+    system->queues = NULL;
+    system->workerCount = 0;
+}
+
+void ParallelFor(JobSystem* system, int count, int chunkSize, JobFunc func, void* data) {
+    if (count <= 0) return;
+    if (chunkSize < 1) chunkSize = 1;
+    int chunkCount = (count + chunkSize - 1) / chunkSize;
+    if (system == NULL || system->workerCount == 0 || chunkCount == 1) {
+        func(data, 0, count);
+        return;
+    }
+
+    // Kuyruklar taşmasın diye gerekirse parçalar büyütülür
+    int queueCount = system->workerCount + 1;
+    if (chunkCount > queueCount * JOB_QUEUE_CAPACITY) {
+        chunkSize = (count + queueCount * JOB_QUEUE_CAPACITY - 1) / (queueCount * JOB_QUEUE_CAPACITY);
+        chunkCount = (count + chunkSize - 1) / chunkSize;
+    }
+    AtomicStore(&system->pending, chunkCount);
+
+    // Her kuyruğa ardışık parçalar verilir; komşu varlıklar aynı çekirdekte kalır
+    for (int q = 0; q < queueCount; q++) {
+        int first = (int)((long long)chunkCount * q / queueCount);
+        int last = (int)((long long)chunkCount * (q + 1) / queueCount);
+        JobQueue* queue = &system->queues[q];
+        LockMutex(&queue->mutex);
+        queue->head = queue->tail = 0;
+        // Sahip sondan aldığı için parçalar ters sırayla eklenir
+        for (int c = last - 1; c >= first; c--) {
+            int begin = c * chunkSize;
+            int end = begin + chunkSize < count ? begin + chunkSize : count;
+            queue->jobs[queue->tail % JOB_QUEUE_CAPACITY] = (Job){ func, data, begin, end };
+            queue->tail++;
+        }
+        UnlockMutex(&queue->mutex);
+    }
+
+    LockMutex(&system->mutex);
+    BroadcastCondition(&system->wake);
+    UnlockMutex(&system->mutex);
+
+    RunJobs(system, 0);
+
+    LockMutex(&system->mutex);
+    while (AtomicLoad(&system->pending) > 0) WaitCondition(&system->done, &system->mutex);
+    UnlockMutex(&system->mutex);
+}
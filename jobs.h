@@ -0,0 +1,61 @@
+#ifndef JOBS_H
+#define JOBS_H
+
+// Küçük iş çalma (work-stealing) iş sistemi. ParallelFor bir aralığı
+// parçalara bölüp iş parçacıklarının kuyruklarına dağıtır; her iş parçacığı
+// önce kendi kuyruğunun sonundan alır, boşalınca diğerlerinin başından
+// çalar. Çağıran iş parçacığı da çalışır ve tüm parçalar bitince döner.
+// Aynı anda tek ParallelFor desteklenir (ana döngüden çağrılır).
+
+#include "thread.h"
+#include <stdbool.h>
+
+#define JOB_MAX_WORKERS 15
+#define JOB_QUEUE_CAPACITY 1024 // Kuyruk başına parça
+
+// begin/end: işlenecek [begin, end) aralığı
+typedef void (*JobFunc)(void* data, int begin, int end);
+
+typedef struct {
+    JobFunc func;
+    void* data;
+    int begin;
+    int end;
+} Job;
+
+// Her kuyruğu yalnızca kendi kilidi korur; çalan ile sahip nadiren çakışır
+typedef struct {
+    Job jobs[JOB_QUEUE_CAPACITY];
+    int head; // Çalınan uç
+    int tail; // Sahibin uç
+    Mutex mutex;
+} JobQueue;
+
+typedef struct JobSystem JobSystem;
+
+typedef struct {
+    JobSystem* system;
+    int index;
+} JobWorker;
+
+struct JobSystem {
+    JobQueue* queues;     // workerCount + 1 kuyruk, 0: çağıran iş parçacığı
+    Thread workers[JOB_MAX_WORKERS];
+    JobWorker workerArgs[JOB_MAX_WORKERS];
+    int workerCount;
+    volatile int pending; // Bitmemiş parça sayısı
+    bool quit;
+    Mutex mutex;
+    Condition wake;       // Yeni iş veya kapanış
+    Condition done;       // pending sıfıra indi
+};
+
+// workerCount <= 0 ise çekirdek sayısının bir eksiği kullanılır. Tek
+// çekirdekte işçi açılmaz ve ParallelFor seri çalışır.
+bool InitJobSystem(JobSystem* system, int workerCount);
+void FreeJobSystem(JobSystem* system);
+
+// [0, count) aralığını chunkSize'lık parçalara böler ve hepsi bitince döner.
+void ParallelFor(JobSystem* system, int count, int chunkSize, JobFunc func, void* data);
+
+#endif
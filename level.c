@@ -0,0 +1,414 @@
+#include "level.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int ChunkOf(float x, int chunkWidth, int chunkCount) {
+    int c = (int)floorf(x / chunkWidth);
+    if (c < 0) c = 0;
+    if (c >= chunkCount) c = chunkCount - 1;
+    return c;
+}
+
+// Eleman sonlu konumda, parkurun içinde ve kaydedildiği parçanın x
+// aralığında olmalı (SaveLevel parçayı ChunkOf ile seçer)
+static bool IsValidRecordRect(const LevelHeader* header, uint32_t chunkIndex, float x, float y, float width, float height) {
+    if (!isfinite(x) || !isfinite(y) || width <= 0.0f || height <= 0.0f) return false;
+    if (y < -LEVEL_MAX_HEIGHT || y + height > LEVEL_MAX_HEIGHT) return false;
+    if (x < GROUND_START_X || (double)x + width > (double)GROUND_START_X + header->levelLength) return false;
+    return ChunkOf(x, (int)header->chunkWidth, (int)header->chunkCount) == (int)chunkIndex;
+}
+
+// Parçanın kayıtlarını doğrular; LoadChunk bunları denetlemeden kopyalar
+static bool IsValidChunkData(const LevelHeader* header, uint32_t chunkIndex, const LevelChunkRecord* chunk, const uint8_t* data) {
+    const LevelBlockRecord* blockRecords = (const LevelBlockRecord*)(data + chunk->offset);
+    const LevelEnemyRecord* enemyRecords = (const LevelEnemyRecord*)(blockRecords + chunk->blockCount);
+    const LevelCoinRecord* coinRecords = (const LevelCoinRecord*)(enemyRecords + chunk->enemyCount);
+    for (int k = 0; k < chunk->blockCount; k++) {
+        const LevelBlockRecord* r = &blockRecords[k];
+        if (r->type > BLOCK_STONE || r->hasCoin > 1 ||
+            !IsValidRecordRect(header, chunkIndex, r->x, r->y, BLOCK_SIZE, BLOCK_SIZE)) {
+            return false;
+        }
+    }
+    for (int k = 0; k < chunk->enemyCount; k++) {
+        const LevelEnemyRecord* r = &enemyRecords[k];
+        // NaN karşılaştırmada yanlış döner; sıfır ve negatif hız da reddedilir
+        if (!(r->speed > 0.0f && r->speed <= LEVEL_MAX_ENEMY_SPEED) ||
+            !IsValidRecordRect(header, chunkIndex, r->x, r->y, ENEMY_SIZE, ENEMY_SIZE)) {
+            return false;
+        }
+    }
+    for (int k = 0; k < chunk->coinCount; k++) {
+        const LevelCoinRecord* r = &coinRecords[k];
+        if (!IsValidRecordRect(header, chunkIndex, r->x, r->y, COIN_SIZE, COIN_SIZE)) return false;
+    }
+    return true;
+}
+
+bool OpenLevel(Level* level, const char* path) {
+    memset(level, 0, sizeof(*level));
+    for (int s = 0; s < LEVEL_RESIDENT_CHUNKS; s++) level->residentChunk[s] = -1;
+    if (!MapFile(&level->file, path)) return false;
+
+    const uint8_t* data = level->file.data;
+    size_t size = level->file.size;
+    const LevelHeader* header = (const LevelHeader*)data;
+    if (size < sizeof(LevelHeader) || memcmp(header->magic, LEVEL_MAGIC, 4) != 0 || header->version != LEVEL_VERSION ||
+        header->chunkWidth == 0 || header->chunkWidth > LEVEL_MAX_LENGTH ||
+        header->chunkCount == 0 || header->chunkCount > LEVEL_MAX_CHUNKS ||
+        header->levelLength < LEVEL_MIN_LENGTH || header->levelLength > LEVEL_MAX_LENGTH ||
+        // SaveLevel'ın yazdığı gibi son parça uzunluğun bittiği parça olmalı
+        header->levelLength > (uint64_t)header->chunkCount * header->chunkWidth ||
+        header->levelLength <= (uint64_t)(header->chunkCount - 1) * header->chunkWidth ||
+        header->blockTotal > header->chunkCount * LEVEL_CHUNK_MAX_BLOCKS ||
+        header->enemyTotal > header->chunkCount * LEVEL_CHUNK_MAX_ENEMIES ||
+        header->coinTotal > header->chunkCount * LEVEL_CHUNK_MAX_COINS ||
+        (size - sizeof(LevelHeader)) / sizeof(LevelChunkRecord) < header->chunkCount) {
+        CloseLevel(level);
+        return false;
+    }
+
+    // Parça tablosunu doğrula: sayılar yuva kapasitesini, veriler dosyayı,
+    // indeks aralıkları toplamları aşmamalı (toplama taşmasın diye çıkarmayla)
+    const LevelChunkRecord* chunks = (const LevelChunkRecord*)(data + sizeof(LevelHeader));
+    for (uint32_t c = 0; c < header->chunkCount; c++) {
+        const LevelChunkRecord* chunk = &chunks[c];
+        size_t bytes = chunk->blockCount * sizeof(LevelBlockRecord) + chunk->enemyCount * sizeof(LevelEnemyRecord) +
+            chunk->coinCount * sizeof(LevelCoinRecord);
+        if (chunk->blockCount > LEVEL_CHUNK_MAX_BLOCKS || chunk->enemyCount > LEVEL_CHUNK_MAX_ENEMIES ||
+            chunk->coinCount > LEVEL_CHUNK_MAX_COINS || chunk->offset % 4 != 0 || chunk->offset > size ||
+            bytes > size - chunk->offset ||
+            chunk->firstBlock > header->blockTotal || chunk->blockCount > header->blockTotal - chunk->firstBlock ||
+            chunk->firstEnemy > header->enemyTotal || chunk->enemyCount > header->enemyTotal - chunk->firstEnemy ||
+            chunk->firstCoin > header->coinTotal || chunk->coinCount > header->coinTotal - chunk->firstCoin ||
+            !IsValidChunkData(header, c, chunk, data)) {
+            CloseLevel(level);
+            return false;
+        }
+    }
+
+    level->header = header;
+    level->chunks = chunks;
+    level->blockHit = calloc(FLAG_WORDS(header->blockTotal + 1), sizeof(uint32_t));
+    level->enemyDead = calloc(FLAG_WORDS(header->enemyTotal + 1), sizeof(uint32_t));
+    level->coinCollected = calloc(FLAG_WORDS(header->coinTotal + 1), sizeof(uint32_t));
+    if (level->blockHit == NULL || level->enemyDead == NULL || level->coinCollected == NULL) {
+        CloseLevel(level);
+        return false;
+    }
+    return true;
+}
+
+void CloseLevel(Level* level) {
+    free(level->blockHit);
+    free(level->enemyDead);
+    free(level->coinCollected);
+    UnmapFile(&level->file);
+    memset(level, 0, sizeof(*level));
+    for (int s = 0; s < LEVEL_RESIDENT_CHUNKS; s++) level->residentChunk[s] = -1;
+}
+
+bool InitLevelWorld(World* world, Level* level, int groundY) {
+    if (!InitWorld(world, groundY, LEVEL_RESIDENT_CHUNKS * LEVEL_CHUNK_MAX_BLOCKS,
+        LEVEL_RESIDENT_CHUNKS * LEVEL_CHUNK_MAX_ENEMIES, LEVEL_RESIDENT_CHUNKS * LEVEL_CHUNK_MAX_COINS)) {
+        return false;
+    }
+    world->levelLength = (int)level->header->levelLength;
+
+    // Tüm yuvalar boş başlar; sayılar sabit kalır, boş yuvaların genişliği 0
+    world->blocks.count = world->blocks.capacity;
+    world->enemies.count = world->enemies.capacity;
+    world->coins.count = world->coins.capacity;
+    for (int i = 0; i < world->blocks.count; i++) ClearBlock(&world->blocks, i);
+    for (int i = 0; i < world->enemies.count; i++) ClearEnemy(&world->enemies, i);
+    for (int i = 0; i < world->coins.count; i++) ClearCoin(&world->coins, i);
+    for (int s = 0; s < LEVEL_RESIDENT_CHUNKS; s++) level->residentChunk[s] = -1;
+    return true;
+}
+
+bool InitLevelNav(World* world, const Level* level) {
+    const LevelHeader* header = level->header;
+    Rectangle* solids = malloc(((size_t)header->blockTotal + 1) * sizeof(Rectangle));
+    if (solids == NULL) return false;
+    int count = 0;
+    for (uint32_t c = 0; c < header->chunkCount; c++) {
+        const LevelChunkRecord* chunk = &level->chunks[c];
+        const LevelBlockRecord* records = (const LevelBlockRecord*)((const uint8_t*)level->file.data + chunk->offset);
+        for (int k = 0; k < chunk->blockCount; k++) {
+            solids[count++] = (Rectangle){ records[k].x, records[k].y, BLOCK_SIZE, BLOCK_SIZE };
+        }
+    }
+    bool ok = InitWorldNav(world, solids, count);
+    free(solids);
+    return ok;
+}
+
+static void EvictChunk(Level* level, World* world, int slot) {
+    const LevelChunkRecord* chunk = &level->chunks[level->residentChunk[slot]];
+
+    for (int k = 0; k < chunk->blockCount; k++) {
+        int i = slot * LEVEL_CHUNK_MAX_BLOCKS + k;
+        SetFlag(level->blockHit, chunk->firstBlock + k, GetFlag(world->blocks.hit, i));
+        SpatialHashRemove(&world->blockGrid, i);
+        ClearBlock(&world->blocks, i);
+    }
+    for (int k = 0; k < chunk->enemyCount; k++) {
+        int i = slot * LEVEL_CHUNK_MAX_ENEMIES + k;
+        SetFlag(level->enemyDead, chunk->firstEnemy + k, !GetFlag(world->enemies.active, i));
+        SpatialHashRemove(&world->enemyGrid, i);
+        ClearEnemy(&world->enemies, i);
+    }
+    for (int k = 0; k < chunk->coinCount; k++) {
+        int i = slot * LEVEL_CHUNK_MAX_COINS + k;
+        SetFlag(level->coinCollected, chunk->firstCoin + k, GetFlag(world->coins.collected, i));
+        SpatialHashRemove(&world->coinGrid, i);
+        ClearCoin(&world->coins, i);
+    }
+    level->residentChunk[slot] = -1;
+}
+
+static void LoadChunk(Level* level, World* world, int slot, int chunkIndex) {
+    const LevelChunkRecord* chunk = &level->chunks[chunkIndex];
+    const uint8_t* data = (const uint8_t*)level->file.data + chunk->offset;
+    const LevelBlockRecord* blockRecords = (const LevelBlockRecord*)data;
+    const LevelEnemyRecord* enemyRecords = (const LevelEnemyRecord*)(blockRecords + chunk->blockCount);
+    const LevelCoinRecord* coinRecords = (const LevelCoinRecord*)(enemyRecords + chunk->enemyCount);
+
+    for (int k = 0; k < chunk->blockCount; k++) {
+        int i = slot * LEVEL_CHUNK_MAX_BLOCKS + k;
+        const LevelBlockRecord* r = &blockRecords[k];
+        BlockType type = (r->type == BLOCK_STONE) ? BLOCK_STONE : BLOCK_QUESTION;
+        PutBlock(&world->blocks, i, (Rectangle){ r->x, r->y, BLOCK_SIZE, BLOCK_SIZE }, type, r->hasCoin != 0);
+        SetFlag(world->blocks.hit, i, GetFlag(level->blockHit, chunk->firstBlock + k));
+        SpatialHashInsert(&world->blockGrid, i, GetBlockRect(&world->blocks, i));
+    }
+    for (int k = 0; k < chunk->enemyCount; k++) {
+        int i = slot * LEVEL_CHUNK_MAX_ENEMIES + k;
+        const LevelEnemyRecord* r = &enemyRecords[k];
+        if (GetFlag(level->enemyDead, chunk->firstEnemy + k)) continue;
+        PutEnemy(&world->enemies, i, (Rectangle){ r->x, r->y, ENEMY_SIZE, ENEMY_SIZE }, r->direction < 0 ? -1 : 1, r->speed);
+        SpatialHashInsert(&world->enemyGrid, i, GetEnemyRect(&world->enemies, i));
+        WakeEnemy(world, i);
+    }
+    for (int k = 0; k < chunk->coinCount; k++) {
+        int i = slot * LEVEL_CHUNK_MAX_COINS + k;
+        const LevelCoinRecord* r = &coinRecords[k];
+        PutCoin(&world->coins, i, (Rectangle){ r->x, r->y, COIN_SIZE, COIN_SIZE });
+        if (GetFlag(level->coinCollected, chunk->firstCoin + k)) SetFlag(world->coins.collected, i, true);
+        else SpatialHashInsert(&world->coinGrid, i, GetCoinRect(&world->coins, i));
+    }
+    level->residentChunk[slot] = chunkIndex;
+}
+
+void StreamLevel(Level* level, World* world, float focusX) {
+    int chunkCount = (int)level->header->chunkCount;
+    int center = (int)floorf(focusX / level->header->chunkWidth);
+    int wanted[LEVEL_RESIDENT_CHUNKS];
+
+    // Penceredeki her parça c % LEVEL_RESIDENT_CHUNKS yuvasına düşer
+    for (int s = 0; s < LEVEL_RESIDENT_CHUNKS; s++) wanted[s] = -1;
+    for (int c = center - LEVEL_RESIDENT_CHUNKS / 2; c <= center + LEVEL_RESIDENT_CHUNKS / 2; c++) {
+        if (c < 0 || c >= chunkCount) continue;
+        wanted[c % LEVEL_RESIDENT_CHUNKS] = c;
+    }
+    for (int s = 0; s < LEVEL_RESIDENT_CHUNKS; s++) {
+        if (level->residentChunk[s] == wanted[s]) continue;
+        if (level->residentChunk[s] != -1) EvictChunk(level, world, s);
+        if (wanted[s] != -1) LoadChunk(level, world, s, wanted[s]);
+    }
+}
+
+// Elemanları parça numarasına göre sıralar (counting sort); order'a indeksleri yazar
+static bool SortByChunk(const float* x, const bool* keep, int count, int chunkWidth, int chunkCount,
+    int* perChunk, int* order) {
+    int* start = calloc(chunkCount + 1, sizeof(int));
+    if (start == NULL) return false;
+    for (int i = 0; i < count; i++) {
+        if (keep[i]) perChunk[ChunkOf(x[i], chunkWidth, chunkCount)]++;
+    }
+    for (int c = 0; c < chunkCount; c++) start[c + 1] = start[c] + perChunk[c];
+    for (int i = 0; i < count; i++) {
+        if (keep[i]) order[start[ChunkOf(x[i], chunkWidth, chunkCount)]++] = i;
+    }
+    free(start);
+    return true;
+}
+
+bool SaveLevel(const char* path, const BlockSet* blocks, const EnemySet* enemies, const CoinSet* coins, int levelLength) {
+    int chunkWidth = LEVEL_CHUNK_WIDTH;
+    if (levelLength < LEVEL_MIN_LENGTH || levelLength > LEVEL_MAX_LENGTH) return false;
+    int chunkCount = (levelLength + chunkWidth - 1) / chunkWidth;
+
+    int maxCount = blocks->count;
+    if (enemies->count > maxCount) maxCount = enemies->count;
+    if (coins->count > maxCount) maxCount = coins->count;
+
+    int* blockPerChunk = calloc(chunkCount, sizeof(int));
+    int* enemyPerChunk = calloc(chunkCount, sizeof(int));
+    int* coinPerChunk = calloc(chunkCount, sizeof(int));
+    int* blockOrder = malloc((blocks->count + 1) * sizeof(int));
+    int* enemyOrder = malloc((enemies->count + 1) * sizeof(int));
+    int* coinOrder = malloc((coins->count + 1) * sizeof(int));
+    bool* keep = malloc((maxCount + 1) * sizeof(bool));
+    LevelChunkRecord* records = calloc(chunkCount, sizeof(LevelChunkRecord));
+    FILE* out = NULL;
+    bool ok = false;
+    if (blockPerChunk == NULL || enemyPerChunk == NULL || coinPerChunk == NULL || blockOrder == NULL ||
+        enemyOrder == NULL || coinOrder == NULL || keep == NULL || records == NULL) {
+        goto cleanup;
+    }
+
+    for (int i = 0; i < blocks->count; i++) keep[i] = blocks->width[i] != 0;
+    if (!SortByChunk(blocks->x, keep, blocks->count, chunkWidth, chunkCount, blockPerChunk, blockOrder)) goto cleanup;
+    for (int i = 0; i < enemies->count; i++) keep[i] = GetFlag(enemies->active, i);
+    if (!SortByChunk(enemies->x, keep, enemies->count, chunkWidth, chunkCount, enemyPerChunk, enemyOrder)) goto cleanup;
+    for (int i = 0; i < coins->count; i++) keep[i] = !GetFlag(coins->collected, i) && coins->width[i] != 0;
+    if (!SortByChunk(coins->x, keep, coins->count, chunkWidth, chunkCount, coinPerChunk, coinOrder)) goto cleanup;
+
+    LevelHeader header = { 0 };
+    memcpy(header.magic, LEVEL_MAGIC, 4);
+    header.version = LEVEL_VERSION;
+    header.chunkWidth = (uint32_t)chunkWidth;
+    header.chunkCount = (uint32_t)chunkCount;
+    header.levelLength = (uint32_t)levelLength;
+
+    uint32_t offset = (uint32_t)(sizeof(LevelHeader) + chunkCount * sizeof(LevelChunkRecord));
+    for (int c = 0; c < chunkCount; c++) {
+        if (blockPerChunk[c] > LEVEL_CHUNK_MAX_BLOCKS || enemyPerChunk[c] > LEVEL_CHUNK_MAX_ENEMIES ||
+            coinPerChunk[c] > LEVEL_CHUNK_MAX_COINS) {
+            goto cleanup;
+        }
+        records[c].offset = offset;
+        records[c].blockCount = (uint16_t)blockPerChunk[c];
+        records[c].enemyCount = (uint16_t)enemyPerChunk[c];
+        records[c].coinCount = (uint16_t)coinPerChunk[c];
+        records[c].firstBlock = header.blockTotal;
+        records[c].firstEnemy = header.enemyTotal;
+        records[c].firstCoin = header.coinTotal;
+        header.blockTotal += blockPerChunk[c];
+        header.enemyTotal += enemyPerChunk[c];
+        header.coinTotal += coinPerChunk[c];
+        offset += (uint32_t)(blockPerChunk[c] * sizeof(LevelBlockRecord) + enemyPerChunk[c] * sizeof(LevelEnemyRecord) +
+            coinPerChunk[c] * sizeof(LevelCoinRecord));
+    }
+
+    out = fopen(path, "wb");
+    if (out == NULL) goto cleanup;
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(records, sizeof(LevelChunkRecord), chunkCount, out);
+    for (int c = 0; c < chunkCount; c++) {
+        for (uint32_t k = 0; k < records[c].blockCount; k++) {
+            int i = blockOrder[records[c].firstBlock + k];
+            LevelBlockRecord r = { blocks->x[i], blocks->y[i], (uint8_t)GetBlockType(blocks, i), GetFlag(blocks->hasCoin, i), 0 };
+            fwrite(&r, sizeof(r), 1, out);
+        }
+        for (uint32_t k = 0; k < records[c].enemyCount; k++) {
+            int i = enemyOrder[records[c].firstEnemy + k];
+            LevelEnemyRecord r = { enemies->x[i], enemies->y[i], enemies->speed[i], enemies->direction[i], { 0 } };
+            fwrite(&r, sizeof(r), 1, out);
+        }
+        for (uint32_t k = 0; k < records[c].coinCount; k++) {
+            int i = coinOrder[records[c].firstCoin + k];
+            LevelCoinRecord r = { coins->x[i], coins->y[i] };
+            fwrite(&r, sizeof(r), 1, out);
+        }
+    }
+    ok = ferror(out) == 0;
+
+cleanup:
+    if (out != NULL && fclose(out) != 0) ok = false;
+    free(blockPerChunk);
+    free(enemyPerChunk);
+    free(coinPerChunk);
+    free(blockOrder);
+    free(enemyOrder);
+    free(coinOrder);
+    free(keep);
+    free(records);
+    return ok;
+}
+
+// Karşılaştırma için elemanın dosyaya giren alanları
+typedef struct {
+    float x, y;
+    float speed;
+    int kind; // 0 blok, 1 düşman, 2 coin
+    int extra; // Blok: tip | coin << 1, düşman: yön
+} LevelElementKey;
+
+static int CompareElementKeys(const void* a, const void* b) {
+    const LevelElementKey* p = a;
+    const LevelElementKey* q = b;
+    if (p->kind != q->kind) return p->kind < q->kind ? -1 : 1;
+    if (p->x != q->x) return p->x < q->x ? -1 : 1;
+    if (p->y != q->y) return p->y < q->y ? -1 : 1;
+    if (p->extra != q->extra) return p->extra < q->extra ? -1 : 1;
+    if (p->speed != q->speed) return p->speed < q->speed ? -1 : 1;
+    return 0;
+}
+
+// SaveLevel'ın filtresiyle (boş yuva, ölü düşman, toplanmış coin hariç) anahtarları ekler
+static int AppendElementKeys(LevelElementKey* keys, int count, const BlockSet* blocks, int blockBegin, int blockEnd,
+    const EnemySet* enemies, int enemyBegin, int enemyEnd, const CoinSet* coins, int coinBegin, int coinEnd) {
+    for (int i = blockBegin; i < blockEnd; i++) {
+        if (blocks->width[i] == 0) continue;
+        keys[count++] = (LevelElementKey){ blocks->x[i], blocks->y[i], 0.0f, 0,
+            (int)GetBlockType(blocks, i) | (int)GetFlag(blocks->hasCoin, i) << 1 };
+    }
+    for (int i = enemyBegin; i < enemyEnd; i++) {
+        if (!GetFlag(enemies->active, i)) continue;
+        keys[count++] = (LevelElementKey){ enemies->x[i], enemies->y[i], enemies->speed[i], 1, enemies->direction[i] };
+    }
+    for (int i = coinBegin; i < coinEnd; i++) {
+        if (GetFlag(coins->collected, i) || coins->width[i] == 0) continue;
+        keys[count++] = (LevelElementKey){ coins->x[i], coins->y[i], 0.0f, 2, 0 };
+    }
+    return count;
+}
+
+int CompareLevelFile(const char* path, const BlockSet* blocks, const EnemySet* enemies, const CoinSet* coins, int levelLength) {
+    Level level;
+    World world;
+    if (!OpenLevel(&level, path)) return -1;
+    if (!InitLevelWorld(&world, &level, 0)) {
+        CloseLevel(&level);
+        return -1;
+    }
+
+    const LevelHeader* header = level.header;
+    size_t streamedTotal = (size_t)header->blockTotal + header->enemyTotal + header->coinTotal;
+    size_t sourceTotal = (size_t)blocks->count + enemies->count + coins->count;
+    LevelElementKey* streamed = malloc((streamedTotal + 1) * sizeof(LevelElementKey));
+    LevelElementKey* source = malloc((sourceTotal + 1) * sizeof(LevelElementKey));
+    int mismatches = -1;
+    if (streamed == NULL || source == NULL) goto cleanup;
+
+    // Her parça pencerenin ortasındayken kendi yuvasındaki elemanlar toplanır
+    int streamedCount = 0;
+    for (uint32_t c = 0; c < header->chunkCount; c++) {
+        StreamLevel(&level, &world, ((float)c + 0.5f) * header->chunkWidth);
+        int slot = (int)(c % LEVEL_RESIDENT_CHUNKS);
+        const LevelChunkRecord* chunk = &level.chunks[c];
+        streamedCount = AppendElementKeys(streamed, streamedCount,
+            &world.blocks, slot * LEVEL_CHUNK_MAX_BLOCKS, slot * LEVEL_CHUNK_MAX_BLOCKS + chunk->blockCount,
+            &world.enemies, slot * LEVEL_CHUNK_MAX_ENEMIES, slot * LEVEL_CHUNK_MAX_ENEMIES + chunk->enemyCount,
+            &world.coins, slot * LEVEL_CHUNK_MAX_COINS, slot * LEVEL_CHUNK_MAX_COINS + chunk->coinCount);
+    }
+    int sourceCount = AppendElementKeys(source, 0, blocks, 0, blocks->count, enemies, 0, enemies->count, coins, 0, coins->count);
+
+    qsort(streamed, streamedCount, sizeof(LevelElementKey), CompareElementKeys);
+    qsort(source, sourceCount, sizeof(LevelElementKey), CompareElementKeys);
+    mismatches = world.levelLength != levelLength;
+    int common = streamedCount < sourceCount ? streamedCount : sourceCount;
+    for (int k = 0; k < common; k++) mismatches += CompareElementKeys(&streamed[k], &source[k]) != 0;
+    mismatches += abs(streamedCount - sourceCount);
+
+cleanup:
+    free(streamed);
+    free(source);
+    FreeWorld(&world);
+    CloseLevel(&level);
+    return mismatches;
+}
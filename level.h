@@ -0,0 +1,106 @@
+#ifndef LEVEL_H
+#define LEVEL_H
+
+// Sabit genişlikli parçalara (chunk) bölünmüş ikili parkur formatı.
+// Dosya belleğe eşlenir; kameranın etrafındaki LEVEL_RESIDENT_CHUNKS
+// parça World'ün blok/düşman/coin dizilerine yüklenir, uzaklaşanlar
+// boşaltılır. Böylece bellek kullanımı parkur uzunluğundan bağımsızdır.
+//
+// Dosya düzeni (little-endian):
+//   LevelHeader
+//   LevelChunkRecord[chunkCount]
+//   her parça için: LevelBlockRecord[] LevelEnemyRecord[] LevelCoinRecord[]
+
+#include "mapfile.h"
+#include "world.h"
+#include <stdint.h>
+
+#define LEVEL_MAGIC "ALVL"
+#define LEVEL_VERSION 1
+#define LEVEL_CHUNK_WIDTH (16 * BLOCK_SIZE)
+#define LEVEL_RESIDENT_CHUNKS 5 // Kameranın parçası ve her iki yanda ikişer parça
+#define LEVEL_CHUNK_MAX_BLOCKS 256
+#define LEVEL_CHUNK_MAX_ENEMIES 64
+#define LEVEL_CHUNK_MAX_COINS 128
+// Dosyadan okunan sayıların üst sınırları: ayırmalar ve int'e çevirmeler taşmaz
+#define LEVEL_MAX_CHUNKS (1 << 20)
+#define LEVEL_MAX_LENGTH (1 << 26)
+// Bir parçadan kısa parkurda düşman sığmayabilir; bu uzunluktan kısası yazılmaz/okunmaz
+#define LEVEL_MIN_LENGTH LEVEL_CHUNK_WIDTH
+// Eleman kayıtlarının sınırları: y bu aralıkta, düşman hızı (0, sınır] içinde olmalı
+#define LEVEL_MAX_HEIGHT (1 << 20)
+#define LEVEL_MAX_ENEMY_SPEED BLOCK_SIZE
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t chunkWidth;
+    uint32_t chunkCount;
+    uint32_t levelLength;
+    uint32_t blockTotal;
+    uint32_t enemyTotal;
+    uint32_t coinTotal;
+} LevelHeader;
+
+typedef struct {
+    uint32_t offset;     // Dosya başından parça verisine
+    uint16_t blockCount;
+    uint16_t enemyCount;
+    uint16_t coinCount;
+    uint16_t reserved;
+    uint32_t firstBlock; // Parkur genelindeki ilk eleman indeksleri
+    uint32_t firstEnemy;
+    uint32_t firstCoin;
+} LevelChunkRecord;
+
+typedef struct {
+    float x, y;
+    uint8_t type;
+    uint8_t hasCoin;
+    uint16_t reserved;
+} LevelBlockRecord;
+
+typedef struct {
+    float x, y;
+    float speed;
+    int8_t direction;
+    uint8_t reserved[3];
+} LevelEnemyRecord;
+
+typedef struct {
+    float x, y;
+} LevelCoinRecord;
+
+typedef struct {
+    MappedFile file;
+    const LevelHeader* header;
+    const LevelChunkRecord* chunks;
+    int residentChunk[LEVEL_RESIDENT_CHUNKS]; // Yuva başına yüklü parça, boşsa -1
+
+    // Boşaltılan parçaların durumu (vurulan blok, ölen düşman, toplanan coin)
+    uint32_t* blockHit;
+    uint32_t* enemyDead;
+    uint32_t* coinCollected;
+} Level;
+
+bool OpenLevel(Level* level, const char* path);
+void CloseLevel(Level* level);
+
+// World'ü yuva kapasiteleriyle kurar; elemanları StreamLevel yükler.
+bool InitLevelWorld(World* world, Level* level, int groundY);
+
+// Kovalayan düşmanlar için gezinme ızgarasını tüm parçaların bloklarından
+// kurar (InitWorldNav); yalnızca yüklü parçalar değil, parkurun tamamı.
+bool InitLevelNav(World* world, const Level* level);
+
+// focusX etrafındaki parçaları yükler, pencere dışına çıkanları boşaltır.
+void StreamLevel(Level* level, World* world, float focusX);
+
+// Dizilerdeki elemanları x konumuna göre parçalara bölüp dosyaya yazar.
+bool SaveLevel(const char* path, const BlockSet* blocks, const EnemySet* enemies, const CoinSet* coins, int levelLength);
+// path'teki parkuru baştan sona akıtır ve yüklenen elemanları SaveLevel'ın
+// yazacağı elemanlarla sıralı olarak karşılaştırır. Birebir aynıysa 0,
+// farklı çıkan eleman (ve uzunluk) sayısını, dosya açılamazsa -1 döner.
+int CompareLevelFile(const char* path, const BlockSet* blocks, const EnemySet* enemies, const CoinSet* coins, int levelLength);
+
+#endif
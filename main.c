@@ -1,216 +1,231 @@
 #include "raylib.h"
+#include "assets.h"
+#include "atlas.h"
+#include "audio.h"
+#include "frameclock.h"
+#include "interpolation.h"
+#include "level.h"
+#include "particledraw.h"
+#include "particles.h"
+#include "profiler.h"
+#include "profilerhud.h"
+#include "replay.h"
+#include "rng.h"
+#include "snapshot.h"
+#include "spritebatch.h"
+#include "staticlayer.h"
+#include "world.h"
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
-#define MARIO_WALK_FRAME_COUNT  3
-#define MARIO_WALK_FRAME_WIDTH  25
-#define MARIO_WALK_FRAME_HEIGHT 49
-#define MARIO_JUMP_WIDTH  25    
-#define MARIO_JUMP_HEIGHT 49
-#define MARIO_IDLE_WIDTH  25
-#define MARIO_IDLE_HEIGHT 49
-#define MARIO_BASE_HEIGHT MARIO_IDLE_HEIGHT
-
-#define CLOUD_COUNT 100
 #define CLOUD_SPACING 200
-#define GROUND_START_X 0
-#define GROUND_LENGTH 2000
-#define MARIO_START_X (GROUND_START_X + 100)
-
-#define MAX_BLOCKS 50
-#define MAX_ENEMIES 10
-#define MAX_COINS 20
-#define BLOCK_SIZE 64
-#define COIN_SIZE 32
-#define ENEMY_SIZE 48
+#define LEVEL_FILE "level1.alvl" // Kaynak köküne göre
+#define REWIND_FRAMES 600 // FIXED_TICK_RATE 60 iken son 10 saniye
+#define REWIND_BYTES (4 << 20)
+#define PARTICLE_POOL (1 << 17)
 
 typedef enum GameScreen { TITLE, GAMEPLAY, SETTINGS } GameScreen;
 
-typedef enum BlockType {
-    BLOCK_QUESTION,
-    BLOCK_STONE
-} BlockType;
-
-typedef struct {
-    Rectangle rect;
-    BlockType type;
-    bool hasCoin;
-    bool hit;
-    Texture2D texture;
-} Block;
-
-typedef struct {
-    Rectangle rect;
-    bool active;
-    int direction;
-    float speed;
-    Texture2D texture;
-} Enemy;
-
-typedef struct {
-    Rectangle rect;
-    bool collected;
-    Texture2D texture;
-} Coin;
-
-void OturtMarioZemine(Vector2* marioPos, int groundY, int baseHeight) {
-    marioPos->y = groundY - baseHeight;
-}
-
-bool CheckCollision(Rectangle a, Rectangle b) {
-    return a.x < b.x + b.width &&
-        a.x + a.width > b.x &&
-        a.y < b.y + b.height &&
-        a.y + a.height > b.y;
-}
-
-// Mini level: platform zemine yakın, düşmanlar zeminde
-void InitLevel(Block blocks[], int* blockCount, Enemy enemies[], int* enemyCount, Coin coins[], int* coinCount, int groundY,
-    Texture2D soruBlok, Texture2D tasBlok, Texture2D coinPng, Texture2D dusmanPng) {
-    int b = 0, e = 0, c = 0;
-
-    // Platform parametreleri
-    int platY = groundY - BLOCK_SIZE - 40; // Zemine daha yakın (40px yukarıda)
-    int platStartX = GROUND_START_X + 250;
-    int platBlockCount = 8; // Platformda toplam blok sayısı (tasblok + sorublok)
-
-    // Platform: [tasblok][sorublok][tasblok][sorublok]...[tasblok]
-    for (int i = 0; i < platBlockCount; i++) {
-        BlockType type = (i % 2 == 0) ? BLOCK_STONE : BLOCK_QUESTION;
-        blocks[b].rect = (Rectangle){ platStartX + i * BLOCK_SIZE, platY, BLOCK_SIZE, BLOCK_SIZE };
-        blocks[b].type = type;
-        blocks[b].hasCoin = (type == BLOCK_QUESTION);
-        blocks[b].hit = false;
-        blocks[b].texture = (type == BLOCK_QUESTION) ? soruBlok : tasBlok;
-        b++;
-
-        // Coin, soru bloğun üstünde
-        if (type == BLOCK_QUESTION) {
-            coins[c].rect = (Rectangle){ platStartX + i * BLOCK_SIZE + (BLOCK_SIZE - COIN_SIZE) / 2, platY - COIN_SIZE, COIN_SIZE, COIN_SIZE };
-            coins[c].collected = false;
-            coins[c].texture = coinPng;
-            c++;
+// Kamera görüş alanı dışındaki elemanlar önce toplu AABB testiyle elenir,
+// kalanlar atlas üzerinden sprite batch'e eklenir. Bloklar statik katmanda.
+// Düşmanlar enemyX/enemyY'deki (ara değerli) konumlarında çizilir.
+#define DRAW_CULL_CHUNK 256
+
+void DrawGameElements(const EnemySet* enemies, const float* enemyX, const float* enemyY, const CoinSet* coins, SpriteBatch* batch) {
+    uint32_t visible[FLAG_WORDS(DRAW_CULL_CHUNK)];
+    // Sprite'lar çarpışma kutusundan büyük olabilir; eleme alanı bir blok genişletilir
+    Rectangle view = { batch->view.x - BLOCK_SIZE, batch->view.y - BLOCK_SIZE,
+        batch->view.width + 2 * BLOCK_SIZE, batch->view.height + 2 * BLOCK_SIZE };
+
+    for (int base = 0; base < enemies->count; base += DRAW_CULL_CHUNK) {
+        int n = enemies->count - base < DRAW_CULL_CHUNK ? enemies->count - base : DRAW_CULL_CHUNK;
+        if (CheckCollisionBatch(view, enemyX + base, enemyY + base, enemies->width + base, enemies->height + base, n, visible) == 0) continue;
+        for (int k = 0; k < n; k++) {
+            int i = base + k;
+            if (!GetFlag(visible, k) || !GetFlag(enemies->active, i)) continue;
+            if (enemies->direction[i] == -1) {
+                DrawSprite(batch, enemies->sprite[i], (Vector2){ enemyX[i], enemyY[i] }, false);
+            }
+            else {
+                DrawSprite(batch, enemies->sprite[i], (Vector2){ enemyX[i] + ENEMY_SIZE, enemyY[i] }, true);
+            }
         }
     }
-
-    // Düşmanlar: zeminde, platformun sol ve sağ taraflarında
-    int enemyY = groundY - ENEMY_SIZE - 100; // Zemin yüksekliği 100, düşman tam üstünde
-    int enemyX1 = platStartX - 120;
-    int enemyX2 = platStartX + platBlockCount * BLOCK_SIZE + 40;
-    enemies[e].rect = (Rectangle){ enemyX1, enemyY, ENEMY_SIZE, ENEMY_SIZE };
-    enemies[e].active = true;
-    enemies[e].direction = 1;
-    enemies[e].speed = 2.0f;
-    enemies[e].texture = dusmanPng;
-    e++;
-
-    enemies[e].rect = (Rectangle){ enemyX2, enemyY, ENEMY_SIZE, ENEMY_SIZE };
-    enemies[e].active = true;
-    enemies[e].direction = -1;
-    enemies[e].speed = 2.0f;
-    enemies[e].texture = dusmanPng;
-    e++;
-
-    *blockCount = b;
-    *enemyCount = e;
-    *coinCount = c;
-}
-
-// Düşmanlar tasbloklara çarpınca yön değiştirir, zeminde hareket eder
-void UpdateEnemies(Enemy enemies[], int enemyCount, Block blocks[], int blockCount) {
-    for (int i = 0; i < enemyCount; i++) {
-        if (!enemies[i].active) continue;
-        enemies[i].rect.x += enemies[i].direction * enemies[i].speed;
-
-        // Tasbloklara çarpınca yön değiştir
-        for (int j = 0; j < blockCount; j++) {
-            if (blocks[j].type == BLOCK_STONE) {
-                Rectangle enemyNext = enemies[i].rect;
-                enemyNext.x += enemies[i].direction * enemies[i].speed;
-                if (CheckCollision(enemyNext, blocks[j].rect)) {
-                    enemies[i].direction *= -1;
-                    break;
-                }
+    for (int base = 0; base < coins->count; base += DRAW_CULL_CHUNK) {
+        int n = coins->count - base < DRAW_CULL_CHUNK ? coins->count - base : DRAW_CULL_CHUNK;
+        if (CheckCollisionBatch(view, coins->x + base, coins->y + base, coins->width + base, coins->height + base, n, visible) == 0) continue;
+        for (int k = 0; k < n; k++) {
+            int i = base + k;
+            if (GetFlag(visible, k) && !GetFlag(coins->collected, i) && coins->width[i] != 0) {
+                DrawSprite(batch, coins->sprite[i], (Vector2){ coins->x[i], coins->y[i] }, false);
             }
         }
-        // Harita sınırından çıkmasın
-        if (enemies[i].rect.x < GROUND_START_X) {
-            enemies[i].rect.x = GROUND_START_X;
-            enemies[i].direction = 1;
-        }
-        if (enemies[i].rect.x > GROUND_START_X + GROUND_LENGTH - ENEMY_SIZE) {
-            enemies[i].rect.x = GROUND_START_X + GROUND_LENGTH - ENEMY_SIZE;
-            enemies[i].direction = -1;
-        }
     }
 }
 
-void HandleCollisions(Vector2* marioPos, Rectangle marioCollider, bool* isJumping, float* velocityY,
-    Block blocks[], int blockCount, Enemy enemies[], int enemyCount, Coin coins[], int coinCount, int* score, int groundY) {
-    for (int i = 0; i < blockCount; i++) {
-        if (blocks[i].rect.width == 0) continue;
-        if (CheckCollision(marioCollider, blocks[i].rect)) {
-            if (marioCollider.y + marioCollider.height <= blocks[i].rect.y + 10 && *velocityY > 0) {
-                marioPos->y = blocks[i].rect.y - marioCollider.height;
-                *velocityY = 0;
-                *isJumping = false;
-                if (blocks[i].type == BLOCK_QUESTION && !blocks[i].hit) {
-                    blocks[i].hit = true;
-                    if (blocks[i].hasCoin) *score += 100;
-                }
-            }
-        }
+// Kaydı pencere açmadan, kare sınırı olmadan oynatır ve her tick'in durum
+// hash'ini kayıttakiyle karşılaştırır
+static int RunReplay(const char* path, const char* resourceRoot, bool byRuns) {
+    Replay replay;
+    if (!LoadReplay(&replay, path)) {
+        fprintf(stderr, "kayit okunamadi: %s\n", path);
+        return 1;
     }
-    for (int i = 0; i < enemyCount; i++) {
-        if (!enemies[i].active) continue;
-        if (CheckCollision(marioCollider, enemies[i].rect)) {
-            // Mario düşmanın üstünden geliyorsa (yani zıplama ile)
-            if (marioCollider.y + marioCollider.height - 5 <= enemies[i].rect.y && *velocityY > 0) {
-                enemies[i].active = false;
-                *velocityY = -10.0f / 2;
-                *score += 200;
-            }
-            // Mario düşmana yandan veya alttan çarparsa (oyun mantığına göre burada Mario'ya zarar verilebilir)
-        }
+    char levelPath[ASSET_PATH_MAX * 2];
+    const char* levelFile = replay.header.level[0] != '\0'
+        ? JoinAssetPath(resourceRoot, replay.header.level, levelPath, sizeof(levelPath)) : NULL;
+    World world;
+    Level level;
+    bool isStreaming;
+    bool ok = InitGameWorld(&world, &level, levelFile, replay.header.groundY, &isStreaming);
+    // Kayıt akışlı parkurla yapıldıysa gömülü level'a düşmek sonucu bozar
+    if (ok && levelFile != NULL && !isStreaming) {
+        FreeGameWorld(&world, &level, isStreaming);
+        ok = false;
     }
-    for (int i = 0; i < coinCount; i++) {
-        if (coins[i].collected || coins[i].rect.width == 0) continue;
-        if (CheckCollision(marioCollider, coins[i].rect)) {
-            coins[i].collected = true;
-            *score += 50;
-        }
+    if (!ok) {
+        fprintf(stderr, "parkur kurulamadi: %s\n", levelFile != NULL ? levelFile : "(gomulu)");
+        FreeReplay(&replay);
+        return 1;
     }
+    JobSystem jobs;
+    bool hasJobs = InitJobSystem(&jobs, 0);
+    if (hasJobs) world.jobs = &jobs;
+
+    uint64_t start = GetMonotonicNs();
+    int mismatch = byRuns ? PlayReplayRuns(&replay, &world, &level, isStreaming) : PlayReplay(&replay, &world, &level, isStreaming, NULL);
+    double seconds = (double)(GetMonotonicNs() - start) / 1e9;
+    int ticks = (int)replay.header.tickCount;
+    printf("replay: %d tick, %.3f s, %.1f tick/s, seed %u, skor %d\n", ticks, seconds,
+        seconds > 0 ? ticks / seconds : 0.0, replay.header.seed, world.score);
+    if (mismatch >= 0) printf("replay: durum %d. tick'te ayristi\n", mismatch);
+    else printf("replay: tum tick'ler eslesti\n");
+
+    if (hasJobs) FreeJobSystem(&jobs);
+    FreeGameWorld(&world, &level, isStreaming);
+    FreeReplay(&replay);
+    return mismatch >= 0 ? 2 : 0;
 }
 
-void DrawGameElements(Block blocks[], int blockCount, Enemy enemies[], int enemyCount, Coin coins[], int coinCount) {
-    for (int i = 0; i < blockCount; i++) {
-        if (blocks[i].rect.width == 0) continue;
-        DrawTexture(blocks[i].texture, blocks[i].rect.x, blocks[i].rect.y, WHITE);
+// Gömülü mini level'ı akışlı parkur dosyasına yazar, dosyayı yeniden açıp
+// baştan sona akıtarak gömülü dünyayla karşılaştırır
+static int RunExportLevel(const char* path, int groundY) {
+    World world;
+    Level level;
+    bool isStreaming;
+    if (!InitGameWorld(&world, &level, NULL, groundY, &isStreaming)) {
+        fprintf(stderr, "gomulu parkur kurulamadi\n");
+        return 1;
     }
-    for (int i = 0; i < enemyCount; i++) {
-        if (!enemies[i].active) continue;
-        if (enemies[i].direction == -1) {
-            DrawTexture(enemies[i].texture, enemies[i].rect.x, enemies[i].rect.y, WHITE);
-        }
-        else {
-            Rectangle flipped = { 0, 0, (float)-enemies[i].texture.width, (float)enemies[i].texture.height };
-            DrawTextureRec(enemies[i].texture, flipped, (Vector2) { enemies[i].rect.x + ENEMY_SIZE, enemies[i].rect.y }, WHITE);
-        }
+    int mismatch = -1;
+    if (SaveLevel(path, &world.blocks, &world.enemies, &world.coins, world.levelLength)) {
+        mismatch = CompareLevelFile(path, &world.blocks, &world.enemies, &world.coins, world.levelLength);
     }
-    for (int i = 0; i < coinCount; i++) {
-        if (!coins[i].collected && coins[i].rect.width != 0) {
-            DrawTexture(coins[i].texture, coins[i].rect.x, coins[i].rect.y, WHITE);
-        }
+    FreeGameWorld(&world, &level, isStreaming);
+    if (mismatch < 0) {
+        fprintf(stderr, "parkur yazilamadi ya da okunamadi: %s\n", path);
+        return 1;
     }
+    if (mismatch > 0) {
+        fprintf(stderr, "parkur: %s gomulu dunyayla %d elemanda ayristi\n", path, mismatch);
+        return 2;
+    }
+    printf("parkur: %s yazildi ve dogrulandi\n", path);
+    return 0;
 }
 
-int main() {
+// Karıştırıcıyı pencere ve ses aygıtı açmadan null arka uçta çalıştırır:
+// parçayı çalar, sonuna yakın bir yere atlar, konumun döngüde başa sarmasını
+// ve durdurunca sıfırlanmasını denetler
+static int RunAudioCheck(const char* path, const char* resourceRoot) {
+    AssetManager assets;
+    if (!InitAssetManager(&assets, resourceRoot, 1)) return 1;
+    AudioMixer audio;
+    if (!InitAudioMixer(&audio, AUDIO_BACKEND_NULL)) {
+        CloseAssetManager(&assets);
+        return 1;
+    }
+    AudioTrackId track = LoadAudioTrack(&audio, &assets, path);
+    double length = GetAudioTrackLength(&audio, track);
+    if (track == -1 || length <= 0.5) {
+        fprintf(stderr, "ses: %s yuklenemedi ya da 0.5 sn'den kisa\n", path);
+        CloseAudioMixer(&audio);
+        CloseAssetManager(&assets);
+        return 1;
+    }
+
+    PlayAudioTrack(&audio, track);
+    SleepMilliseconds(100);
+    double played = GetAudioTrackPosition(&audio, track);
+    double seekTarget = length - 0.05;
+    SeekAudioTrack(&audio, track, seekTarget);
+    double seeked = GetAudioTrackPosition(&audio, track);
+    SleepMilliseconds(200);
+    double wrapped = GetAudioTrackPosition(&audio, track);
+    StopAudioTrack(&audio, track);
+    double stopped = GetAudioTrackPosition(&audio, track);
+    bool isPlaying = IsAudioTrackPlaying(&audio, track);
+    CloseAudioMixer(&audio);
+    CloseAssetManager(&assets);
+
+    // Zamanlayıcı gecikmeleri için konumlar geniş aralıkla denetlenir
+    bool ok = played > 0.0 && played < 0.5 && seeked == seekTarget && wrapped >= 0.0 && wrapped < seekTarget &&
+        stopped == 0.0 && !isPlaying;
+    printf("ses: %s null arka uc, sure %.3f s, calma %.3f, atlama %.3f, sarma %.3f, durdurma %.3f: %s\n", path, length,
+        played, seeked, wrapped, stopped, ok ? "dogru" : "HATALI");
+    return ok ? 0 : 2;
+}
+
+// Komut satırı:
+//   --record <dosya>  oynanışı (girdi + tohum + tick hash'leri) kaydeder
+//   --replay <dosya>  kaydı pencere açmadan en yüksek hızda oynatıp doğrular
+//   --replay-runs 1   aynı girdili tick dizilerini tek büyük adımla oynatır
+//   --seed <sayı>     rastgelelik tohumu (varsayılan: saat)
+//   --export-level <dosya>  gömülü level'ı parkur dosyasına yazıp doğrular
+//                     (oyunun okuduğu LEVEL_FILE bununla üretilir)
+//   --audio-check <dosya>  müzik parçasını null arka uçta çalıp atlatıp
+//                     durdurarak konumları denetler (pencere açmaz)
+//   --fps <sayı>      kare hızı sınırı, 0 sınırsız (varsayılan: 60). Oyun
+//                     hızı kare hızından bağımsızdır (FIXED_TICK_RATE).
+int main(int argc, char** argv) {
     const int screenWidth = 1200;
     const int screenHeight = 800;
 
+    const char* recordPath = NULL;
+    const char* replayPath = NULL;
+    const char* exportPath = NULL;
+    const char* audioCheckPath = NULL;
+    bool replayRuns = false;
+    uint32_t seed = (uint32_t)time(NULL);
+    int targetFps = 60;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--record") == 0) recordPath = argv[i + 1];
+        else if (strcmp(argv[i], "--replay") == 0) replayPath = argv[i + 1];
+        else if (strcmp(argv[i], "--replay-runs") == 0) replayRuns = atoi(argv[i + 1]) != 0;
+        else if (strcmp(argv[i], "--seed") == 0) seed = (uint32_t)strtoul(argv[i + 1], NULL, 10);
+        else if (strcmp(argv[i], "--fps") == 0) targetFps = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--export-level") == 0) exportPath = argv[i + 1];
+        else if (strcmp(argv[i], "--audio-check") == 0) audioCheckPath = argv[i + 1];
+    }
+    if (seed == 0) seed = 1;
+
+    // Kaynaklar kök dizine göre çözülür (varsayılan: exe'nin dizini)
+    const char* resourceRoot = getenv("ALGOLAB_RESOURCES");
+    if (resourceRoot == NULL) resourceRoot = GetApplicationDirectory();
+    if (replayPath != NULL) return RunReplay(replayPath, resourceRoot, replayRuns);
+    if (exportPath != NULL) return RunExportLevel(exportPath, screenHeight - GROUND_HEIGHT);
+    if (audioCheckPath != NULL) return RunAudioCheck(audioCheckPath, resourceRoot);
+
     InitWindow(screenWidth, screenHeight, "Super Mario - Raylib");
-    SetTargetFPS(60);
-    InitAudioDevice();
-    SetMasterVolume(1.0f);
+    SetTargetFPS(targetFps);
+    // Müzik akışları kendi iş parçacığında doldurulur
+    AudioMixer audio;
+    if (!InitAudioMixer(&audio, AUDIO_BACKEND_RAYLIB)) {
+        CloseWindow();
+        return 1;
+    }
 
     GameScreen currentScreen = TITLE;
     Rectangle startButton = { screenWidth / 2 - 400, 340, 300, 80 };
@@ -220,83 +235,166 @@ int main() {
     Rectangle quitButton = { screenWidth / 2 - 100, 360, 200, 50 };
     Rectangle settingsIconRect = { screenWidth - 60, 20, 40, 40 };
 
-    const int groundHeight = 100;
+    const int groundHeight = GROUND_HEIGHT;
     const int groundY = screenHeight;
 
-    Vector2 marioPosition = { MARIO_START_X, groundY - MARIO_BASE_HEIGHT - groundHeight };
-    float marioSpeed = 5.0f;
-    bool isJumping = false;
-    float jumpForce = 10.0f;
-    float gravity = 0.5f;
-    float velocityY = 0;
-    int marioDirection = 1;
-    int walkFrame = 0;
-    int walkFrameCounter = 0;
-    int walkFrameSpeed = 8;
-    int score = 0;
-
-    Texture2D cloudTexture = LoadTexture("C:/Users/ARDA/source/repos/algolab/x64/Debug/cloud.png");
-    Vector2 clouds[CLOUD_COUNT];
-    int cloudIndex = 0;
-    for (int i = 0; i < CLOUD_COUNT * 2 && cloudIndex < CLOUD_COUNT; i++) {
-        float x = GROUND_START_X + i * CLOUD_SPACING;
-        if (x < MARIO_START_X) continue;
-        if (x > GROUND_START_X + GROUND_LENGTH - cloudTexture.width) break;
-        clouds[cloudIndex].x = x;
-        clouds[cloudIndex].y = 50 + rand() % 150;
-        cloudIndex++;
+    // Görüntüler arka planda decode edilir; başlık ekranı beklemeden açılır
+    AssetManager assets;
+    if (!InitAssetManager(&assets, resourceRoot, 0)) {
+        CloseAudioMixer(&audio);
+        CloseWindow();
+        return 1;
+    }
+    AssetHandle titleImage = RequestTexture(&assets, "background.jpg");
+    AssetHandle buttonTexture = RequestTexture(&assets, "button.png");
+    AssetHandle settingsIconTexture = RequestTexture(&assets, "settings.png");
+
+    // Dünya sprite'ları decode edilince tek atlasa paketlenir
+    const char* spriteFiles[SPRITE_COUNT] = { 0 };
+    spriteFiles[SPRITE_QUESTION_BLOCK] = "sorublok.png";
+    spriteFiles[SPRITE_STONE_BLOCK] = "tasblok.png";
+    spriteFiles[SPRITE_COIN] = "coin.png";
+    spriteFiles[SPRITE_ENEMY] = "dusman.png";
+    spriteFiles[SPRITE_MARIO_WALK1] = "MarioWalking1.png";
+    spriteFiles[SPRITE_MARIO_WALK2] = "MarioWalking2.png";
+    spriteFiles[SPRITE_MARIO_WALK3] = "MarioWalking3.png";
+    spriteFiles[SPRITE_MARIO_JUMP] = "MarioJump.png";
+    spriteFiles[SPRITE_MARIO_IDLE] = "MarioIdle.png";
+    spriteFiles[SPRITE_CLOUD] = "cloud.png";
+    AssetHandle spriteImages[SPRITE_COUNT];
+    for (int id = 0; id < SPRITE_COUNT; id++) {
+        spriteImages[id] = spriteFiles[id] != NULL ? RequestImage(&assets, spriteFiles[id]) : -1;
+    }
+    SpriteAtlas atlas = { 0 };
+    bool gameplayReady = false;
+
+    // Zemin, bulutlar ve bloklar karolara önceden çizilir
+    StaticLayer staticLayer;
+    InitStaticLayer(&staticLayer, &atlas, SKYBLUE);
+
+    AudioTrackId titleMusic = LoadAudioTrack(&audio, &assets, "titleMusic.wav");
+    AudioTrackId gameMusic = LoadAudioTrack(&audio, &assets, "gameMusic.wav");
+
+    // Parkur elementleri ve oyun durumu: parkur dosyası varsa parça parça akıtılır,
+    // yoksa gömülü mini level kullanılır
+    World world;
+    Level level;
+    bool isStreaming;
+    char levelPath[ASSET_PATH_MAX * 2];
+    if (!InitGameWorld(&world, &level, ResolveAssetPath(&assets, LEVEL_FILE, levelPath, sizeof(levelPath)),
+        groundY - groundHeight, &isStreaming)) {
+        CloseAssetManager(&assets);
+        CloseAudioMixer(&audio);
+        CloseWindow();
+        return 1;
     }
-    int visibleCloudCount = cloudIndex;
-
-    // PNG'leri yükle
-    Texture2D titleImage = LoadTexture("C:/Users/ARDA/source/repos/algolab/x64/Debug/background.jpg");
-    Texture2D marioWalkTextures[MARIO_WALK_FRAME_COUNT] = {
-        LoadTexture("C:/Users/ARDA/source/repos/algolab/x64/Debug/MarioWalking1.png"),
-        LoadTexture("C:/Users/ARDA/source/repos/algolab/x64/Debug/MarioWalking2.png"),
-        LoadTexture("C:/Users/ARDA/source/repos/algolab/x64/Debug/MarioWalking3.png")
-    };
-    Texture2D marioJumpTexture = LoadTexture("C:/Users/ARDA/source/repos/algolab/x64/Debug/MarioJump.png");
-    Texture2D marioIdleTexture = LoadTexture("C:/Users/ARDA/source/repos/algolab/x64/Debug/MarioIdle.png");
-    Texture2D buttonTexture = LoadTexture("C:/Users/ARDA/source/repos/algolab/x64/Debug/button.png");
-    Texture2D settingsIconTexture = LoadTexture("C:/Users/ARDA/source/repos/algolab/x64/Debug/settings.png");
-    Texture2D coinPng = LoadTexture("C:/Users/ARDA/source/repos/algolab/x64/Debug/coin.png");
-    Texture2D dusmanPng = LoadTexture("C:/Users/ARDA/source/repos/algolab/x64/Debug/dusman.png");
-    Texture2D soruBlok = LoadTexture("C:/Users/ARDA/source/repos/algolab/x64/Debug/sorublok.png");
-    Texture2D tasBlok = LoadTexture("C:/Users/ARDA/source/repos/algolab/x64/Debug/tasblok.png");
-    Music titleMusic = LoadMusicStream("C:/Users/ARDA/source/repos/algolab/x64/Debug/titleMusic.wav");
-    Music gameMusic = LoadMusicStream("C:/Users/ARDA/source/repos/algolab/x64/Debug/gameMusic.wav");
-
-    // Parkur elementleri
-    Block blocks[MAX_BLOCKS] = { 0 };
-    Enemy enemies[MAX_ENEMIES] = { 0 };
-    Coin coins[MAX_COINS] = { 0 };
-    int blockCount = 0, enemyCount = 0, coinCount = 0;
-    InitLevel(blocks, &blockCount, enemies, &enemyCount, coins, &coinCount, groundY - groundHeight, soruBlok, tasBlok, coinPng, dusmanPng);
+
+    // Bulutlar atlas hazır olunca (bulut genişliği bilindiğinde) parkur boyunca
+    // yerleştirilir; dizi ayrılamazsa bulut çizilmez
+    int cloudCapacity = world.levelLength / CLOUD_SPACING + 1;
+    Vector2* clouds = malloc(cloudCapacity * sizeof(Vector2));
+    if (clouds == NULL) cloudCapacity = 0;
+    uint32_t cloudRng = seed;
+    int visibleCloudCount = 0;
+    int cloudWidth = 0;
+
+    ReplayRecorder recorder = { 0 };
+    if (recordPath != NULL && !BeginRecording(&recorder, recordPath, seed, world.groundY, isStreaming ? LEVEL_FILE : "")) {
+        TraceLog(LOG_WARNING, "REPLAY: kayit dosyasi acilamadi: %s", recordPath);
+    }
+
+    // Backspace: geri sar (her tick'in durumu halkada), F5: hızlı kayıt, F9:
+    // hızlı kaydı yükle. Oynanış kaydedilirken geri sarma ve yükleme kapalı;
+    // kayıttaki girdi akışı bozulur.
+    SnapshotLayout snapshotLayout;
+    InitSnapshotLayout(&snapshotLayout, &world, isStreaming ? &level : NULL);
+    SnapshotRing rewind;
+    bool canRewind = recorder.file == NULL && InitSnapshotRing(&rewind, &snapshotLayout, REWIND_FRAMES, REWIND_BYTES);
+    if (canRewind) PushSnapshot(&rewind);
+    char quickSavePath[ASSET_PATH_MAX * 2];
+    snprintf(quickSavePath, sizeof(quickSavePath), "%s/algolab_save.snap", GetWorkingDirectory());
+
+    // Düşman güncellemesi tüm çekirdeklere dağıtılır; açılamazsa seri yol kullanılır
+    JobSystem jobs;
+    bool hasJobs = InitJobSystem(&jobs, 0);
+    if (hasJobs) world.jobs = &jobs;
+
+    // Blok, coin ve ezme olaylarının efektleri; havuz ayrılamazsa efekt çizilmez
+    ParticleSystem particles;
+    bool hasParticles = InitParticleSystem(&particles, PARTICLE_POOL, seed);
+
+    // Oyun sabit FIXED_TICK_RATE'te ilerler; çizim son iki tick arasında ara
+    // değer alır. Bellek ayrılamazsa son tick'in durumu olduğu gibi çizilir.
+    FrameClock frameClock;
+    InitFrameClock(&frameClock, GetMonotonicNs());
+    RenderInterpolation lerp;
+    bool hasLerp = InitRenderInterpolation(&lerp, world.enemies.capacity);
+    if (hasLerp) CaptureRenderState(&lerp, &world);
+    Vector2 marioDrawPosition = world.marioPosition;
+    bool jumpPressed = false; // Tick çalışmayan karede basılan zıplama sonraki tick'e taşınır
 
     Camera2D camera = { 0 };
     camera.offset = (Vector2){ screenWidth / 2.0f, screenHeight - groundHeight / 2.0f };
-    camera.target = (Vector2){ marioPosition.x + MARIO_WALK_FRAME_WIDTH / 2, groundY - groundHeight / 2 };
+    camera.target = (Vector2){ world.marioPosition.x + MARIO_WALK_FRAME_WIDTH / 2, groundY - groundHeight / 2 };
     camera.rotation = 0.0f;
     camera.zoom = 1.0f;
 
     bool isMuted = false;
 
+    // F3: profil ve zamanlama HUD'u, F4: sonraki PROFILE_HISTORY kareyi trace dosyasına kaydet
+    ProfilerStats profiler = { 0 };
+    bool showProfiler = false;
+
     while (!WindowShouldClose()) {
-        if (currentScreen == TITLE && titleMusic.stream.buffer != NULL) {
-            UpdateMusicStream(titleMusic);
+        PROFILE_BEGIN(PROFILE_FRAME);
+        if (IsKeyPressed(KEY_F3)) {
+            showProfiler = !showProfiler;
+            SetProfilerEnabled(showProfiler || profiler.captureFramesLeft > 0);
         }
-        else if (currentScreen == GAMEPLAY && gameMusic.stream.buffer != NULL) {
-            UpdateMusicStream(gameMusic);
+        if (IsKeyPressed(KEY_F4) && profiler.captureFramesLeft == 0) {
+            ProfilerCaptureFrames(&profiler, PROFILE_HISTORY, TextFormat("%s/algolab_trace.json", GetWorkingDirectory()));
+            SetProfilerEnabled(true);
+        }
+
+        // Decode'u biten dokuları GPU'ya yükle; sprite'lar bitince atlası kur
+        PROFILE_BEGIN(PROFILE_ASSETS);
+        int pendingAssets = PumpAssets(&assets, 4);
+        PROFILE_END(PROFILE_ASSETS);
+        if (!gameplayReady && pendingAssets == 0) {
+            Image images[SPRITE_COUNT] = { 0 };
+            for (int id = 0; id < SPRITE_COUNT; id++) images[id] = GetAssetImage(&assets, spriteImages[id]);
+            BuildSpriteAtlas(&atlas, images);
+            for (int id = 0; id < SPRITE_COUNT; id++) {
+                ReleaseAsset(&assets, spriteImages[id]);
+                spriteImages[id] = -1;
+            }
+
+            cloudWidth = (int)atlas.regions[SPRITE_CLOUD].width;
+            int cloudIndex = 0;
+            for (int i = 0; cloudIndex < cloudCapacity; i++) {
+                float x = GROUND_START_X + (float)i * CLOUD_SPACING;
+                if (x < MARIO_START_X) continue;
+                if (x > GROUND_START_X + world.levelLength - cloudWidth) break;
+                clouds[cloudIndex].x = x;
+                clouds[cloudIndex].y = 50 + RandomRange(&cloudRng, 0, 149);
+                cloudIndex++;
+            }
+            visibleCloudCount = cloudIndex;
+            SetStaticLayerClouds(&staticLayer, clouds, visibleCloudCount);
+            gameplayReady = true;
         }
 
         Vector2 mousePoint = GetMousePosition();
 
+        // Menülerde oyun saati durur
+        if (currentScreen != GAMEPLAY) HoldFrameClock(&frameClock, GetMonotonicNs());
+
         switch (currentScreen) {
         case TITLE:
-            if (CheckCollisionPointRec(mousePoint, startButton) && IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) {
+            if (gameplayReady && CheckCollisionPointRec(mousePoint, startButton) && IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) {
                 currentScreen = GAMEPLAY;
-                if (titleMusic.stream.buffer != NULL) StopMusicStream(titleMusic);
-                if (gameMusic.stream.buffer != NULL) PlayMusicStream(gameMusic);
+                StopAudioTrack(&audio, titleMusic);
+                PlayAudioTrack(&audio, gameMusic);
             }
             else if (CheckCollisionPointRec(mousePoint, exitButton) && IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) {
                 break;
@@ -304,71 +402,71 @@ int main() {
             break;
 
         case GAMEPLAY: {
-            bool isMoving = false;
-            float marioRightLimit = GROUND_START_X + GROUND_LENGTH - MARIO_WALK_FRAME_WIDTH;
-
-            if (IsKeyDown(KEY_RIGHT)) {
-                marioPosition.x += marioSpeed;
-                if (marioPosition.x > marioRightLimit) marioPosition.x = marioRightLimit;
-                isMoving = true;
-                marioDirection = 1;
-            }
-            if (IsKeyDown(KEY_LEFT)) {
-                if (marioPosition.x > GROUND_START_X) {
-                    marioPosition.x -= marioSpeed;
-                    if (marioPosition.x < GROUND_START_X) marioPosition.x = GROUND_START_X;
-                    isMoving = true;
-                    marioDirection = -1;
+            // Girdi kare başında okunur (raylib önceki karenin EndDrawing'inde
+            // topladı) ve bu karenin tick'lerinin hepsinde kullanılır
+            bool left = IsKeyDown(KEY_LEFT), right = IsKeyDown(KEY_RIGHT);
+            jumpPressed = jumpPressed || IsKeyPressed(KEY_SPACE);
+            SampleFrameInput(&frameClock, (uint32_t)left | (uint32_t)right << 1 | (uint32_t)IsKeyDown(KEY_SPACE) << 2);
+            bool rewinding = canRewind && IsKeyDown(KEY_BACKSPACE);
+            int ticks = BeginFrameTicks(&frameClock, GetMonotonicNs());
+
+            if (!rewinding && canRewind && IsKeyPressed(KEY_F9)) {
+                if (LoadSnapshot(&snapshotLayout, quickSavePath)) {
+                    ClearSnapshotRing(&rewind);
+                    PushSnapshot(&rewind);
+                    if (hasParticles) ClearParticles(&particles);
+                    if (hasLerp) CaptureRenderState(&lerp, &world);
                 }
-            }
-
-            if (isMoving && !isJumping) {
-                walkFrameCounter++;
-                if (walkFrameCounter >= walkFrameSpeed) {
-                    walkFrameCounter = 0;
-                    walkFrame++;
-                    if (walkFrame >= MARIO_WALK_FRAME_COUNT) walkFrame = 0;
+                else {
+                    TraceLog(LOG_WARNING, "SNAPSHOT: hizli kayit yuklenemedi: %s", quickSavePath);
                 }
             }
-            else {
-                walkFrame = 0;
-                walkFrameCounter = 0;
-            }
-
-            if (IsKeyPressed(KEY_SPACE) && !isJumping) {
-                velocityY = -jumpForce;
-                isJumping = true;
+            for (int t = 0; t < ticks; t++) {
+                BeginFrameTick(&frameClock, GetMonotonicNs());
+                // Ara değer yalnızca karenin son tick'inin öncesine göre alınır
+                if (hasLerp && t == ticks - 1) CaptureRenderState(&lerp, &world);
+                WorldInput input = { left, right, jumpPressed };
+                jumpPressed = false;
+                // Backspace basılıyken tick başına bir kare geri sarılır
+                if (rewinding) {
+                    RewindSnapshots(&rewind, 1);
+                }
+                else {
+                    PROFILE_BEGIN(PROFILE_STEP);
+                    StepGameTick(&world, &level, isStreaming, input);
+                    PROFILE_END(PROFILE_STEP);
+                    RecordTick(&recorder, input, &world);
+                    if (canRewind) PushSnapshot(&rewind);
+                }
+                if (hasParticles) {
+                    PROFILE_BEGIN(PROFILE_PARTICLES);
+                    EmitWorldEventParticles(&particles, &world.events);
+                    UpdateParticles(&particles);
+                    PROFILE_END(PROFILE_PARTICLES);
+                }
             }
-
-            velocityY += gravity;
-            marioPosition.y += velocityY;
-
-            int zeminY = groundY - groundHeight;
-            if (marioPosition.y >= zeminY - MARIO_BASE_HEIGHT) {
-                OturtMarioZemine(&marioPosition, zeminY, MARIO_BASE_HEIGHT);
-                isJumping = false;
-                velocityY = 0;
+            if (IsKeyPressed(KEY_F5) && !SaveSnapshot(&snapshotLayout, quickSavePath)) {
+                TraceLog(LOG_WARNING, "SNAPSHOT: hizli kayit yazilamadi: %s", quickSavePath);
             }
 
-            Rectangle marioCollider = { marioPosition.x, marioPosition.y, MARIO_WALK_FRAME_WIDTH, MARIO_WALK_FRAME_HEIGHT };
-            UpdateEnemies(enemies, enemyCount, blocks, blockCount);
-            HandleCollisions(&marioPosition, marioCollider, &isJumping, &velocityY, blocks, blockCount, enemies, enemyCount, coins, coinCount, &score, groundY - groundHeight);
-
             if (CheckCollisionPointRec(mousePoint, settingsIconRect) && IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) {
                 currentScreen = SETTINGS;
+                PauseAudioTrack(&audio, gameMusic);
             }
 
-            camera.target = (Vector2){ marioPosition.x + MARIO_WALK_FRAME_WIDTH / 2, groundY - groundHeight / 2 };
+            marioDrawPosition = hasLerp ? InterpolateWorld(&lerp, &world, GetFrameAlpha(&frameClock)) : world.marioPosition;
+            camera.target = (Vector2){ marioDrawPosition.x + MARIO_WALK_FRAME_WIDTH / 2, groundY - groundHeight / 2 };
             break;
         }
 
         case SETTINGS:
             if (CheckCollisionPointRec(mousePoint, resumeButton) && IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) {
                 currentScreen = GAMEPLAY;
+                ResumeAudioTrack(&audio, gameMusic);
             }
             else if (CheckCollisionPointRec(mousePoint, soundButton) && IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) {
                 isMuted = !isMuted;
-                SetMasterVolume(isMuted ? 0.0f : 1.0f);
+                SetAudioMuted(&audio, isMuted);
             }
             else if (CheckCollisionPointRec(mousePoint, quitButton) && IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) {
                 break;
@@ -376,29 +474,37 @@ int main() {
             break;
         }
 
+        // Karolara çizim framebuffer değiştirir; ekran çizimi başlamadan yapılır
+        Rectangle cameraView = GetCameraView(camera, screenWidth, screenHeight);
+        if (currentScreen == GAMEPLAY) {
+            PROFILE_BEGIN(PROFILE_STATIC_LAYER);
+            UpdateStaticLayer(&staticLayer, &world, cameraView);
+            PROFILE_END(PROFILE_STATIC_LAYER);
+        }
+
+        PROFILE_BEGIN(PROFILE_DRAW);
         BeginDrawing();
         ClearBackground(SKYBLUE);
 
         if (currentScreen == GAMEPLAY) {
             BeginMode2D(camera);
 
-            // Bulutlar
-            for (int i = 0; i < visibleCloudCount; i++) {
-                if (clouds[i].x >= GROUND_START_X && clouds[i].x <= GROUND_START_X + GROUND_LENGTH - cloudTexture.width) {
-                    DrawTexture(cloudTexture, clouds[i].x, clouds[i].y, WHITE);
-                }
-            }
+            // Zemin, bulutlar ve bloklar: yalnızca görünen karolar
+            DrawStaticLayer(&staticLayer, cameraView);
 
-            // Zemin (yeşil)
-            DrawRectangle(GROUND_START_X, groundY - 100, GROUND_LENGTH, 100, GREEN);
+            SpriteBatch batch;
+            BeginSpriteBatch(&batch, &atlas, cameraView);
 
             // Parkur elementleri
-            DrawGameElements(blocks, blockCount, enemies, enemyCount, coins, coinCount);
+            PROFILE_BEGIN(PROFILE_DRAW_ELEMENTS);
+            DrawGameElements(&world.enemies, hasLerp ? lerp.drawX : world.enemies.x, hasLerp ? lerp.drawY : world.enemies.y,
+                &world.coins, &batch);
+            PROFILE_END(PROFILE_DRAW_ELEMENTS);
 
             // Mario çizimi
-            Vector2 drawPos = marioPosition;
+            Vector2 drawPos = marioDrawPosition;
             int offsetY = 0;
-            if (isJumping)
+            if (world.isJumping)
                 offsetY = MARIO_BASE_HEIGHT - MARIO_JUMP_HEIGHT;
             else if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_LEFT))
                 offsetY = MARIO_BASE_HEIGHT - MARIO_WALK_FRAME_HEIGHT;
@@ -406,45 +512,36 @@ int main() {
                 offsetY = MARIO_BASE_HEIGHT - MARIO_IDLE_HEIGHT;
             drawPos.y += offsetY;
 
-            if (isJumping) {
-                Rectangle jumpSource = { 0, 0, marioDirection == 1 ? MARIO_JUMP_WIDTH : -MARIO_JUMP_WIDTH, MARIO_JUMP_HEIGHT };
-                if (marioDirection == -1) drawPos.x += MARIO_JUMP_WIDTH;
-                DrawTextureRec(marioJumpTexture, jumpSource, drawPos, WHITE);
+            if (world.isJumping) {
+                if (world.marioDirection == -1) drawPos.x += MARIO_JUMP_WIDTH;
+                DrawSprite(&batch, SPRITE_MARIO_JUMP, drawPos, world.marioDirection == -1);
             }
             else if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_LEFT)) {
-                Texture2D currentWalkTexture = marioWalkTextures[walkFrame];
-                if (marioDirection == 1) {
-                    DrawTexture(currentWalkTexture, drawPos.x, drawPos.y, WHITE);
-                }
-                else {
-                    Rectangle src = { 0, 0, (float)-currentWalkTexture.width, (float)currentWalkTexture.height };
-                    DrawTextureRec(currentWalkTexture, src, drawPos, WHITE);
-                }
+                DrawSprite(&batch, SPRITE_MARIO_WALK1 + world.walkFrame, drawPos, world.marioDirection != 1);
             }
             else {
-                if (marioDirection == 1) {
-                    DrawTexture(marioIdleTexture, drawPos.x, drawPos.y, WHITE);
-                }
-                else {
-                    Rectangle src = { 0, 0, (float)-marioIdleTexture.width, (float)marioIdleTexture.height };
-                    DrawTextureRec(marioIdleTexture, src, drawPos, WHITE);
-                }
+                DrawSprite(&batch, SPRITE_MARIO_IDLE, drawPos, world.marioDirection != 1);
             }
 
+            EndSpriteBatch(&batch);
+            if (hasParticles) DrawParticles(&particles, cameraView);
             EndMode2D();
 
             DrawText("Super Mario - Raylib", 10, 10, 20, BLACK);
-            DrawText(TextFormat("Skor: %d", score), 10, 40, 20, BLACK);
-            DrawTexture(settingsIconTexture, settingsIconRect.x, settingsIconRect.y, WHITE);
+            DrawText(TextFormat("Skor: %d", world.score), 10, 40, 20, BLACK);
+            if (showProfiler) DrawFrameTimingOverlay(&frameClock, 160, DrawProfilerOverlay(&profiler, 160, 40) + 4);
+            DrawTexture(GetAssetTexture(&assets, settingsIconTexture), settingsIconRect.x, settingsIconRect.y, WHITE);
         }
         else if (currentScreen == TITLE) {
-            DrawTexture(titleImage, 0, 0, WHITE);
+            Texture2D titleTexture = GetAssetTexture(&assets, titleImage);
+            Texture2D button = GetAssetTexture(&assets, buttonTexture);
+            DrawTexture(titleTexture, 0, 0, WHITE);
             DrawText("SUPER MANO BROS", screenWidth / 2 - MeasureText("SUPER MANO BROS", 50) / 1, 100, 75, YELLOW);
 
-            DrawTexture(buttonTexture, startButton.x + (startButton.width - buttonTexture.width) / 2,
-                startButton.y + (startButton.height - buttonTexture.height) / 2, WHITE);
-            DrawTexture(buttonTexture, exitButton.x + (exitButton.width - buttonTexture.width) / 2,
-                exitButton.y + (exitButton.height - buttonTexture.height) / 2, WHITE);
+            DrawTexture(button, startButton.x + (startButton.width - button.width) / 2,
+                startButton.y + (startButton.height - button.height) / 2, WHITE);
+            DrawTexture(button, exitButton.x + (exitButton.width - button.width) / 2,
+                exitButton.y + (exitButton.height - button.height) / 2, WHITE);
 
             if (CheckCollisionPointRec(mousePoint, startButton))
                 DrawRectangle(startButton.x, startButton.y, startButton.width, startButton.height, Fade(YELLOW, 0.4f));
@@ -455,6 +552,7 @@ int main() {
                 startButton.y + startButton.height / 2 - 20, 45, BLACK);
             DrawText("CIKIS", exitButton.x + exitButton.width / 2 - MeasureText("CIKIS", 40) / 2,
                 exitButton.y + exitButton.height / 2 - 20, 42, BLACK);
+            if (!gameplayReady) DrawText("YUKLENIYOR...", startButton.x, startButton.y - 40, 30, BLACK);
         }
         else if (currentScreen == SETTINGS) {
             DrawRectangleGradientV(0, 0, screenWidth, screenHeight, DARKGRAY, GRAY);
@@ -471,26 +569,39 @@ int main() {
                 quitButton.y + quitButton.height / 2 - 15, 30, BLACK);
         }
 
+        PROFILE_END(PROFILE_DRAW);
+
+        PROFILE_BEGIN(PROFILE_END_DRAWING);
         EndDrawing();
+        PROFILE_END(PROFILE_END_DRAWING);
+        EndFrameClock(&frameClock, GetMonotonicNs());
+        PROFILE_END(PROFILE_FRAME);
+
+        if (profilerEnabled) {
+            if (ProfilerEndFrame(&profiler)) TraceLog(LOG_INFO, "PROFILER: trace kaydedildi: %s", profiler.capturePath);
+            if (!showProfiler && profiler.captureFramesLeft == 0) SetProfilerEnabled(false);
+        }
     }
 
     // Kaynakları serbest bırak
-    UnloadTexture(titleImage);
-    for (int i = 0; i < MARIO_WALK_FRAME_COUNT; i++) UnloadTexture(marioWalkTextures[i]);
-    UnloadTexture(marioJumpTexture);
-    UnloadTexture(marioIdleTexture);
-    UnloadTexture(buttonTexture);
-    UnloadTexture(settingsIconTexture);
-    UnloadTexture(cloudTexture);
-    UnloadTexture(coinPng);
-    UnloadTexture(dusmanPng);
-    UnloadTexture(soruBlok);
-    UnloadTexture(tasBlok);
-
-    if (titleMusic.stream.buffer != NULL) UnloadMusicStream(titleMusic);
-    if (gameMusic.stream.buffer != NULL) UnloadMusicStream(gameMusic);
-
-    CloseAudioDevice();
+    ReleaseAsset(&assets, titleImage);
+    ReleaseAsset(&assets, buttonTexture);
+    ReleaseAsset(&assets, settingsIconTexture);
+    for (int id = 0; id < SPRITE_COUNT; id++) ReleaseAsset(&assets, spriteImages[id]);
+    UnloadStaticLayer(&staticLayer);
+    free(clouds);
+    UnloadSpriteAtlas(&atlas);
+    EndRecording(&recorder);
+    if (canRewind) FreeSnapshotRing(&rewind);
+    if (hasParticles) FreeParticleSystem(&particles);
+    if (hasLerp) FreeRenderInterpolation(&lerp);
+    if (hasJobs) FreeJobSystem(&jobs);
+    FreeGameWorld(&world, &level, isStreaming);
+
+    CloseAssetManager(&assets);
+    FreeProfilerStats(&profiler);
+
+    CloseAudioMixer(&audio);
     CloseWindow();
     return 0;
 }
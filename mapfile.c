@@ -0,0 +1,72 @@
+#include "mapfile.h"
+#include <string.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+bool MapFile(MappedFile* file, const char* path) {
+    memset(file, 0, sizeof(*file));
+    HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size) || size.QuadPart == 0) {
+        CloseHandle(handle);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL) {
+        CloseHandle(handle);
+        return false;
+    }
+    const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == NULL) {
+        CloseHandle(mapping);
+        CloseHandle(handle);
+        return false;
+    }
+    file->data = data;
+    file->size = (size_t)size.QuadPart;
+    file->fileHandle = handle;
+    file->mappingHandle = mapping;
+    return true;
+}
+
+void UnmapFile(MappedFile* file) {
+    if (file->data != NULL) UnmapViewOfFile(file->data);
+    if (file->mappingHandle != NULL) CloseHandle(file->mappingHandle);
+    if (file->fileHandle != NULL) CloseHandle(file->fileHandle);
+    memset(file, 0, sizeof(*file));
+}
+
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool MapFile(MappedFile* file, const char* path) {
+    memset(file, 0, sizeof(*file));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+
+    file->data = data;
+    file->size = (size_t)st.st_size;
+    return true;
+}
+
+void UnmapFile(MappedFile* file) {
+    if (file->data != NULL) munmap((void*)file->data, file->size);
+    memset(file, 0, sizeof(*file));
+}
+#endif
@@ -0,0 +1,20 @@
+#ifndef MAPFILE_H
+#define MAPFILE_H
+
+// Salt okunur dosya eşleme. windows.h raylib.h ile çakıştığı için
+// platform kodu bu dosyada, raylib'den bağımsız tutulur.
+
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const void* data;
+    size_t size;
+    void* fileHandle;
+    void* mappingHandle;
+} MappedFile;
+
+bool MapFile(MappedFile* file, const char* path);
+void UnmapFile(MappedFile* file);
+
+#endif
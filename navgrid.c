@@ -0,0 +1,297 @@
+#include "navgrid.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    float top;
+    float bottom;
+} NavSpan;
+
+// Sütun başına üstten alta sıralı, birleştirilmiş katı aralıklar; yalnızca kurulumda tutulur
+typedef struct {
+    NavSpan* spans;
+    int* start; // Sütun c'nin aralıkları spans[start[c]]'den başlar
+    int* count;
+} NavColumns;
+
+static int ColumnOf(const NavGrid* nav, float x) {
+    int c = (int)floorf(x / NAV_CELL_SIZE);
+    if (c < 0) c = 0;
+    if (c >= nav->columns) c = nav->columns - 1;
+    return c;
+}
+
+// Dikdörtgen, ortası içinde kalan sütunları kaplar; sınırda kalmayan
+// küçük dikdörtgen hiçbir sütuna düşmeyebilir (last < first)
+static void SolidColumns(Rectangle rect, int columns, int* first, int* last) {
+    *first = (int)ceilf((rect.x - NAV_CELL_SIZE / 2.0f) / NAV_CELL_SIZE);
+    *last = (int)ceilf((rect.x + rect.width - NAV_CELL_SIZE / 2.0f) / NAV_CELL_SIZE) - 1;
+    if (*first < 0) *first = 0;
+    if (*last > columns - 1) *last = columns - 1;
+}
+
+static bool IsNavSolid(Rectangle rect, int groundY) {
+    return rect.width > 0 && rect.height > 0 && rect.y < groundY;
+}
+
+static void FreeNavColumns(NavColumns* cols) {
+    free(cols->spans);
+    free(cols->start);
+    free(cols->count);
+}
+
+static bool BuildNavColumns(NavColumns* cols, const Rectangle* solids, int solidCount, int columns, int groundY) {
+    cols->start = calloc(columns + 1, sizeof(int));
+    cols->count = calloc(columns, sizeof(int));
+    cols->spans = NULL;
+    if (cols->start == NULL || cols->count == NULL) return false;
+
+    int first, last;
+    for (int i = 0; i < solidCount; i++) {
+        if (!IsNavSolid(solids[i], groundY)) continue;
+        SolidColumns(solids[i], columns, &first, &last);
+        for (int c = first; c <= last; c++) cols->start[c + 1]++;
+    }
+    for (int c = 0; c < columns; c++) cols->start[c + 1] += cols->start[c];
+    cols->spans = malloc((cols->start[columns] + 1) * sizeof(NavSpan));
+    if (cols->spans == NULL) return false;
+    for (int i = 0; i < solidCount; i++) {
+        if (!IsNavSolid(solids[i], groundY)) continue;
+        NavSpan span = { solids[i].y, fminf(solids[i].y + solids[i].height, (float)groundY) };
+        SolidColumns(solids[i], columns, &first, &last);
+        for (int c = first; c <= last; c++) cols->spans[cols->start[c] + cols->count[c]++] = span;
+    }
+
+    // Sütunda birkaç aralık olur; ekleme sıralaması yeter
+    for (int c = 0; c < columns; c++) {
+        NavSpan* spans = cols->spans + cols->start[c];
+        int count = cols->count[c];
+        for (int k = 1; k < count; k++) {
+            NavSpan span = spans[k];
+            int j = k;
+            while (j > 0 && spans[j - 1].top > span.top) {
+                spans[j] = spans[j - 1];
+                j--;
+            }
+            spans[j] = span;
+        }
+        int merged = 0;
+        for (int k = 0; k < count; k++) {
+            if (merged > 0 && spans[k].top <= spans[merged - 1].bottom) {
+                spans[merged - 1].bottom = fmaxf(spans[merged - 1].bottom, spans[k].bottom);
+            }
+            else {
+                spans[merged++] = spans[k];
+            }
+        }
+        cols->count[c] = merged;
+    }
+    return true;
+}
+
+// Sütunun k. aralığının üstü, bir üstteki aralıkla arasında düşman sığıyorsa
+// zemindir; k == count parkur zeminidir (bir aralık zemine oturmuyorsa)
+static bool FloorAt(const NavColumns* cols, int c, int k, int groundY, float* floorY) {
+    const NavSpan* spans = cols->spans + cols->start[c];
+    int count = cols->count[c];
+    float y;
+    if (k < count) {
+        y = spans[k].top;
+    }
+    else {
+        if (count > 0 && spans[count - 1].bottom >= groundY) return false;
+        y = (float)groundY;
+    }
+    if (k > 0 && spans[k - 1].bottom > y - NAV_AGENT_HEIGHT) return false;
+    *floorY = y;
+    return true;
+}
+
+// Sütunda (top, bottom) dikey aralığına giren katı yoksa true
+static bool ColumnFree(const NavColumns* cols, int c, float top, float bottom) {
+    const NavSpan* spans = cols->spans + cols->start[c];
+    for (int k = 0; k < cols->count[c]; k++) {
+        if (spans[k].top < bottom && spans[k].bottom > top) return false;
+    }
+    return true;
+}
+
+// Sütunda feetY'de ya da altındaki ilk zemin düğümü
+static int FirstNodeBelow(const NavGrid* nav, int c, float feetY) {
+    for (int v = nav->columnStart[c]; v < nav->columnStart[c + 1]; v++) {
+        if (nav->floorY[v] >= feetY - NAV_FLOOR_EPSILON) return v;
+    }
+    return -1;
+}
+
+// Her düğümden komşu sütunlara giden kenarları sayar; from verilirse yazar.
+// Aynı yükseklikte geçilebilen komşuda düşman ilk zemine iner (yürüme ya
+// da düşme); NAV_JUMP_HEIGHT içindeki daha yüksek zeminlere, kendi
+// sütununda yükselecek boşluk varsa zıplanır.
+static int BuildEdges(const NavGrid* nav, const NavColumns* cols, int* from, int* to, uint8_t* move) {
+    int count = 0;
+    for (int c = 0; c < nav->columns; c++) {
+        for (int u = nav->columnStart[c]; u < nav->columnStart[c + 1]; u++) {
+            float f = nav->floorY[u];
+            for (int d = -1; d <= 1; d += 2) {
+                int n = c + d;
+                if (n < 0 || n >= nav->columns) continue;
+                if (ColumnFree(cols, n, f - NAV_AGENT_HEIGHT, f)) {
+                    int v = FirstNodeBelow(nav, n, f);
+                    if (v >= 0) {
+                        if (from != NULL) {
+                            from[count] = u;
+                            to[count] = v;
+                            move[count] = d < 0 ? NAV_MOVE_LEFT : NAV_MOVE_RIGHT;
+                        }
+                        count++;
+                    }
+                }
+                // Düğümler yukarıdan aşağı sıralı
+                for (int v = nav->columnStart[n]; v < nav->columnStart[n + 1]; v++) {
+                    float g = nav->floorY[v];
+                    if (g >= f - NAV_FLOOR_EPSILON) break;
+                    if (g < f - NAV_JUMP_HEIGHT || !ColumnFree(cols, c, g - NAV_AGENT_HEIGHT, f - NAV_AGENT_HEIGHT)) continue;
+                    if (from != NULL) {
+                        from[count] = u;
+                        to[count] = v;
+                        move[count] = d < 0 ? NAV_MOVE_JUMP_LEFT : NAV_MOVE_JUMP_RIGHT;
+                    }
+                    count++;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+static bool BuildNodes(NavGrid* nav, const NavColumns* cols) {
+    nav->columnStart = calloc(nav->columns + 1, sizeof(int));
+    if (nav->columnStart == NULL) return false;
+    float y;
+    for (int c = 0; c < nav->columns; c++) {
+        nav->columnStart[c + 1] = nav->columnStart[c];
+        for (int k = 0; k <= cols->count[c]; k++) {
+            if (FloorAt(cols, c, k, nav->groundY, &y)) nav->columnStart[c + 1]++;
+        }
+    }
+    nav->nodeCount = nav->columnStart[nav->columns];
+    nav->floorY = malloc((nav->nodeCount + 1) * sizeof(float));
+    if (nav->floorY == NULL) return false;
+    int v = 0;
+    for (int c = 0; c < nav->columns; c++) {
+        for (int k = 0; k <= cols->count[c]; k++) {
+            if (FloorAt(cols, c, k, nav->groundY, &y)) nav->floorY[v++] = y;
+        }
+    }
+    return true;
+}
+
+// Akış alanı hedeften geriye yayıldığı için kenarlar hedef düğüme göre gruplanır
+static bool BuildIncomingEdges(NavGrid* nav, const NavColumns* cols) {
+    int edgeCount = BuildEdges(nav, cols, NULL, NULL, NULL);
+    int* from = malloc((edgeCount + 1) * sizeof(int));
+    int* to = malloc((edgeCount + 1) * sizeof(int));
+    uint8_t* move = malloc((edgeCount + 1) * sizeof(uint8_t));
+    int* cursor = malloc((nav->nodeCount + 1) * sizeof(int));
+    nav->edgeStart = calloc(nav->nodeCount + 1, sizeof(int));
+    nav->edgeFrom = malloc((edgeCount + 1) * sizeof(int));
+    nav->edgeMove = malloc((edgeCount + 1) * sizeof(uint8_t));
+    bool ok = from != NULL && to != NULL && move != NULL && cursor != NULL && nav->edgeStart != NULL &&
+        nav->edgeFrom != NULL && nav->edgeMove != NULL;
+    if (ok) {
+        BuildEdges(nav, cols, from, to, move);
+        for (int e = 0; e < edgeCount; e++) nav->edgeStart[to[e] + 1]++;
+        for (int v = 0; v < nav->nodeCount; v++) nav->edgeStart[v + 1] += nav->edgeStart[v];
+        memcpy(cursor, nav->edgeStart, (nav->nodeCount + 1) * sizeof(int));
+        for (int e = 0; e < edgeCount; e++) {
+            int k = cursor[to[e]]++;
+            nav->edgeFrom[k] = from[e];
+            nav->edgeMove[k] = move[e];
+        }
+    }
+    free(from);
+    free(to);
+    free(move);
+    free(cursor);
+    return ok;
+}
+
+bool BakeNavGrid(NavGrid* nav, const Rectangle* solids, int solidCount, int levelLength, int groundY) {
+    memset(nav, 0, sizeof(*nav));
+    nav->columns = (levelLength + NAV_CELL_SIZE - 1) / NAV_CELL_SIZE;
+    if (nav->columns < 1) nav->columns = 1;
+    nav->groundY = groundY;
+    nav->target = -1;
+
+    NavColumns cols;
+    bool ok = BuildNavColumns(&cols, solids, solidCount, nav->columns, groundY) && BuildNodes(nav, &cols) &&
+        BuildIncomingEdges(nav, &cols);
+    FreeNavColumns(&cols);
+    if (ok) {
+        nav->move = calloc(nav->nodeCount + 1, sizeof(uint8_t));
+        nav->queue = malloc((nav->nodeCount + 1) * sizeof(int));
+        ok = nav->move != NULL && nav->queue != NULL;
+    }
+    if (!ok) FreeNavGrid(nav);
+    return ok;
+}
+
+void FreeNavGrid(NavGrid* nav) {
+    free(nav->columnStart);
+    free(nav->floorY);
+    free(nav->edgeStart);
+    free(nav->edgeFrom);
+    free(nav->edgeMove);
+    free(nav->move);
+    free(nav->queue);
+    memset(nav, 0, sizeof(*nav));
+    nav->target = -1;
+}
+
+int FindNavNode(const NavGrid* nav, float x, float feetY) {
+    int c = ColumnOf(nav, x);
+    int node = FirstNodeBelow(nav, c, feetY);
+    // Bir bloğun içine girmişse (altında zemin yok) sütunun en alttaki zemini
+    if (node < 0 && nav->columnStart[c + 1] > nav->columnStart[c]) node = nav->columnStart[c + 1] - 1;
+    return node;
+}
+
+// Hedef her düğüm değiştirdiğinde baştan kurulur: pencere en çok
+// 2 * NAV_FLOW_COLUMNS + 1 sütun olduğu için BFS birkaç bin düğümü geçmez.
+bool UpdateFlowField(NavGrid* nav, float x, float feetY) {
+    int target = FindNavNode(nav, x, feetY);
+    if (target == nav->target) return false;
+
+    memset(nav->move + nav->flowBegin, NAV_MOVE_NONE, nav->flowEnd - nav->flowBegin);
+    nav->target = target;
+    nav->flowBegin = nav->flowEnd = 0;
+    if (target < 0) return true;
+
+    int column = ColumnOf(nav, x);
+    int first = column - NAV_FLOW_COLUMNS < 0 ? 0 : column - NAV_FLOW_COLUMNS;
+    int last = column + NAV_FLOW_COLUMNS >= nav->columns ? nav->columns - 1 : column + NAV_FLOW_COLUMNS;
+    int begin = nav->columnStart[first], end = nav->columnStart[last + 1];
+    nav->flowBegin = begin;
+    nav->flowEnd = end;
+
+    int head = 0, tail = 0;
+    nav->move[target] = NAV_MOVE_ARRIVED;
+    nav->queue[tail++] = target;
+    while (head < tail) {
+        int v = nav->queue[head++];
+        for (int e = nav->edgeStart[v]; e < nav->edgeStart[v + 1]; e++) {
+            int u = nav->edgeFrom[e];
+            if (u < begin || u >= end || nav->move[u] != NAV_MOVE_NONE) continue;
+            nav->move[u] = nav->edgeMove[e];
+            nav->queue[tail++] = u;
+        }
+    }
+    return true;
+}
+
+NavMove GetNavMove(const NavGrid* nav, float x, float feetY) {
+    int node = FindNavNode(nav, x, feetY);
+    return node < 0 ? NAV_MOVE_NONE : (NavMove)nav->move[node];
+}
@@ -0,0 +1,66 @@
+#ifndef NAVGRID_H
+#define NAVGRID_H
+
+// Düşmanların Mario'yu kovalaması için gezinme ızgarası ve akış alanı.
+// Parkur NAV_CELL_SIZE genişliğinde sütunlara bölünür; her sütunda
+// düşmanın sığdığı zeminler (blok üstleri ve parkur zemini) bir düğümdür.
+// Düğümler arasındaki kenarlar komşu sütuna yürüme/düşme ve zıplayarak
+// çıkmadır. Izgara yüklemede bir kez kurulur (bloklar yerinden oynamaz).
+//
+// Akış alanı Mario'nun bulunduğu düğümden geriye doğru tek bir BFS ile
+// her düğüme hedefe giden ilk hamleyi yazar; Mario düğüm değiştirmedikçe
+// yeniden kurulmaz. Düşman sayısından bağımsızdır: her düşman yalnızca
+// kendi düğümündeki hamleyi okur.
+
+#include "raylib.h"
+#include "world.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define NAV_CELL_SIZE BLOCK_SIZE
+#define NAV_AGENT_HEIGHT ENEMY_SIZE      // Bir zeminde durmak ve geçmek için gereken boşluk
+#define NAV_JUMP_HEIGHT (2 * BLOCK_SIZE) // ENEMY_JUMP_FORCE ile ayaklar ~138px yükselir
+#define NAV_FLOW_COLUMNS 128             // Akış alanı hedefin iki yanında bu kadar sütunu kapsar
+#define NAV_FLOOR_EPSILON 1.0f
+
+typedef enum NavMove {
+    NAV_MOVE_NONE,       // Hedefe yol yok ya da alanın dışında
+    NAV_MOVE_LEFT,       // Yürü (kenardan düşmek dahil)
+    NAV_MOVE_RIGHT,
+    NAV_MOVE_JUMP_LEFT,  // Komşu sütundaki daha yüksek zemine zıpla
+    NAV_MOVE_JUMP_RIGHT,
+    NAV_MOVE_ARRIVED     // Mario ile aynı düğümde
+} NavMove;
+
+struct NavGrid {
+    int columns;
+    int nodeCount;
+    int groundY;
+    int* columnStart; // Sütun c'nin düğümleri [columnStart[c], columnStart[c + 1]), yukarıdan aşağı
+    float* floorY;    // Düğümün zemini (ayakların y'si)
+
+    // Gelen kenarlar: düğüm v'ye edgeFrom[e]'den edgeMove[e] hamlesiyle gelinir
+    int* edgeStart;
+    int* edgeFrom;
+    uint8_t* edgeMove;
+
+    // Akış alanı
+    uint8_t* move;          // Düğüm başına NavMove
+    int* queue;
+    int target;             // Alanın kurulduğu düğüm, yoksa -1
+    int flowBegin, flowEnd; // move'un doldurulduğu düğüm aralığı
+};
+
+// solids: parkurun tüm katı dikdörtgenleri (akışlı parkurda yüklü olmayanlar dahil).
+bool BakeNavGrid(NavGrid* nav, const Rectangle* solids, int solidCount, int levelLength, int groundY);
+void FreeNavGrid(NavGrid* nav);
+
+// x konumundaki sütunda ayakların (feetY) üstünde durduğu ya da düşeceği
+// düğüm; altında zemin yoksa sütunun en alttaki zemini, sütunda hiç yoksa -1.
+int FindNavNode(const NavGrid* nav, float x, float feetY);
+// Hedef düğüm değiştiyse akış alanını yeniden kurar ve true döner.
+bool UpdateFlowField(NavGrid* nav, float x, float feetY);
+// Konumdaki düşmanın hedefe doğru hamlesi; düğüm araması sütundaki zemin sayısı kadardır.
+NavMove GetNavMove(const NavGrid* nav, float x, float feetY);
+
+#endif
@@ -0,0 +1,44 @@
+#include "particledraw.h"
+#include "rlgl.h"
+
+// Batch sınırı her parçacıkta değil bu kadar dörtgende bir denetlenir
+#define PARTICLE_DRAW_CHUNK 1024
+
+static const Color particleColors[PARTICLE_EFFECT_COUNT] = {
+    [PARTICLE_BLOCK_DEBRIS] = { 181, 101, 29, 255 },
+    [PARTICLE_COIN_SPARKLE] = { 255, 203, 0, 255 },
+    [PARTICLE_STOMP_DUST] = { 210, 210, 210, 255 },
+};
+
+int DrawParticles(const ParticleSystem* system, Rectangle view) {
+    const float* x = system->x;
+    const float* y = system->y;
+    float left = view.x - PARTICLE_SIZE, right = view.x + view.width;
+    float top = view.y - PARTICLE_SIZE, bottom = view.y + view.height;
+    int drawn = 0;
+
+    rlSetTexture(rlGetTextureIdDefault());
+    for (int base = 0; base < system->count; base += PARTICLE_DRAW_CHUNK) {
+        int end = system->count - base < PARTICLE_DRAW_CHUNK ? system->count : base + PARTICLE_DRAW_CHUNK;
+        // Batch dolacaksa rlgl önce mevcut dörtgenleri gönderir; doku yeniden seçilmeli
+        if (rlCheckRenderBatchLimit(4 * (end - base))) rlSetTexture(rlGetTextureIdDefault());
+        rlBegin(RL_QUADS);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+        rlTexCoord2f(0.0f, 0.0f);
+        for (int i = base; i < end; i++) {
+            if (x[i] <= left || x[i] >= right || y[i] <= top || y[i] >= bottom) continue;
+            Color color = particleColors[system->effect[i]];
+            float life = system->life[i];
+            unsigned char alpha = life >= PARTICLE_FADE_TICKS ? 255 : (unsigned char)(255.0f * life / PARTICLE_FADE_TICKS);
+            rlColor4ub(color.r, color.g, color.b, alpha);
+            rlVertex2f(x[i], y[i]);
+            rlVertex2f(x[i], y[i] + PARTICLE_SIZE);
+            rlVertex2f(x[i] + PARTICLE_SIZE, y[i] + PARTICLE_SIZE);
+            rlVertex2f(x[i] + PARTICLE_SIZE, y[i]);
+            drawn++;
+        }
+        rlEnd();
+    }
+    rlSetTexture(0);
+    return drawn;
+}
@@ -0,0 +1,14 @@
+#ifndef PARTICLEDRAW_H
+#define PARTICLEDRAW_H
+
+// Parçacıkları rlgl'in varsayılan beyaz dokusuyla renkli dörtgen olarak
+// aktif batch'e ekler. Hepsi aynı dokuyu kullandığı için raylib onları
+// sprite'lardan ayrı tek bir draw call'da gönderir (batch dolarsa böler).
+
+#include "raylib.h"
+#include "particles.h"
+
+// Görüş alanındaki parçacıkları çizer, çizilen sayısını döner.
+int DrawParticles(const ParticleSystem* system, Rectangle view);
+
+#endif
@@ -0,0 +1,183 @@
+#include "particles.h"
+#include "rng.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define PARTICLES_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PARTICLES_SSE2 1
+#endif
+
+#define PARTICLE_PI 3.14159265f
+
+typedef struct {
+    int count;
+    float direction; // Radyan, -pi/2 yukarı
+    float spread;    // Yön etrafındaki toplam açı
+    float speedMin, speedMax;
+    float lifeMin, lifeMax;
+} ParticleEmitter;
+
+static const ParticleEmitter emitters[PARTICLE_EFFECT_COUNT] = {
+    [PARTICLE_BLOCK_DEBRIS] = { 24, -PARTICLE_PI / 2, PARTICLE_PI * 0.6f, 2.0f, 6.0f, 30.0f, 50.0f },
+    [PARTICLE_COIN_SPARKLE] = { 16, -PARTICLE_PI / 2, PARTICLE_PI, 1.0f, 4.0f, 20.0f, 40.0f },
+    [PARTICLE_STOMP_DUST] = { 32, -PARTICLE_PI / 2, PARTICLE_PI * 0.9f, 1.0f, 3.5f, 20.0f, 35.0f },
+};
+
+// [0, 1)
+static float NextUnit(uint32_t* rng) {
+    return (float)(NextRandom(rng) >> 8) * (1.0f / 16777216.0f);
+}
+
+bool InitParticleSystem(ParticleSystem* system, int capacity, uint32_t seed) {
+    memset(system, 0, sizeof(*system));
+    int n = capacity > 0 ? capacity : 1;
+    system->x = malloc(n * sizeof(float));
+    system->y = malloc(n * sizeof(float));
+    system->vx = malloc(n * sizeof(float));
+    system->vy = malloc(n * sizeof(float));
+    system->life = malloc(n * sizeof(float));
+    system->effect = malloc(n * sizeof(uint8_t));
+    system->dead = malloc(FLAG_WORDS(n) * sizeof(uint32_t));
+    if (system->x == NULL || system->y == NULL || system->vx == NULL || system->vy == NULL || system->life == NULL ||
+        system->effect == NULL || system->dead == NULL) {
+        FreeParticleSystem(system);
+        return false;
+    }
+    system->capacity = capacity;
+    system->rng = seed != 0 ? seed : 1;
+    return true;
+}
+
+void FreeParticleSystem(ParticleSystem* system) {
+    free(system->x);
+    free(system->y);
+    free(system->vx);
+    free(system->vy);
+    free(system->life);
+    free(system->effect);
+    free(system->dead);
+    memset(system, 0, sizeof(*system));
+}
+
+void ClearParticles(ParticleSystem* system) {
+    system->count = 0;
+}
+
+int EmitParticles(ParticleSystem* system, ParticleEffect effect, Rectangle rect) {
+    const ParticleEmitter* emitter = &emitters[effect];
+    int n = emitter->count;
+    if (n > system->capacity - system->count) n = system->capacity - system->count;
+    for (int k = 0; k < n; k++) {
+        int i = system->count++;
+        float angle = emitter->direction + (NextUnit(&system->rng) - 0.5f) * emitter->spread;
+        float speed = emitter->speedMin + NextUnit(&system->rng) * (emitter->speedMax - emitter->speedMin);
+        system->x[i] = rect.x + NextUnit(&system->rng) * rect.width;
+        system->y[i] = rect.y + NextUnit(&system->rng) * rect.height;
+        system->vx[i] = cosf(angle) * speed;
+        system->vy[i] = sinf(angle) * speed;
+        system->life[i] = emitter->lifeMin + NextUnit(&system->rng) * (emitter->lifeMax - emitter->lifeMin);
+        system->effect[i] = (uint8_t)effect;
+    }
+    return n;
+}
+
+void EmitWorldEventParticles(ParticleSystem* system, WorldEventLog* events) {
+    for (int k = 0; k < events->count; k++) {
+        const WorldEvent* event = &events->items[k];
+        switch (event->type) {
+        case WORLD_EVENT_BLOCK_HIT:
+            // Mario bloğa üstten basar; kırıntılar üst kenardan saçılır
+            EmitParticles(system, PARTICLE_BLOCK_DEBRIS, (Rectangle){ event->rect.x, event->rect.y, event->rect.width, 4.0f });
+            break;
+        case WORLD_EVENT_COIN_COLLECTED:
+            EmitParticles(system, PARTICLE_COIN_SPARKLE, event->rect);
+            break;
+        case WORLD_EVENT_ENEMY_STOMPED:
+            EmitParticles(system, PARTICLE_STOMP_DUST, event->rect);
+            break;
+        }
+    }
+    events->count = 0;
+}
+
+// bits'in en yüksek set bitinin indeksi; bits 0 olmamalı
+static int HighestBit(uint32_t bits) {
+    int n = 0;
+    if (bits >> 16) { bits >>= 16; n += 16; }
+    if (bits >> 8) { bits >>= 8; n += 8; }
+    if (bits >> 4) { bits >>= 4; n += 4; }
+    if (bits >> 2) { bits >>= 2; n += 2; }
+    if (bits >> 1) n += 1;
+    return n;
+}
+
+// Sondaki canlı parçacık ölenin yerine taşınır. Ölenler büyükten küçüğe
+// işlendiği için taşınan parçacık hiçbir zaman ölü değildir.
+static void RemoveDead(ParticleSystem* system) {
+    for (int w = FLAG_WORDS(system->count) - 1; w >= 0; w--) {
+        uint32_t bits = system->dead[w];
+        while (bits != 0) {
+            int b = HighestBit(bits);
+            bits &= ~(1u << b);
+            int i = w * 32 + b;
+            int last = --system->count;
+            if (i == last) continue;
+            system->x[i] = system->x[last];
+            system->y[i] = system->y[last];
+            system->vx[i] = system->vx[last];
+            system->vy[i] = system->vy[last];
+            system->life[i] = system->life[last];
+            system->effect[i] = system->effect[last];
+        }
+    }
+}
+
+void UpdateParticles(ParticleSystem* system) {
+    int count = system->count;
+    float* x = system->x;
+    float* y = system->y;
+    float* vx = system->vx;
+    float* vy = system->vy;
+    float* life = system->life;
+    uint32_t* dead = system->dead;
+    memset(dead, 0, FLAG_WORDS(count) * sizeof(uint32_t));
+
+    int i = 0;
+#if defined(PARTICLES_AVX)
+    __m256 gravity = _mm256_set1_ps(PARTICLE_GRAVITY), one = _mm256_set1_ps(1.0f), zero = _mm256_setzero_ps();
+    for (; i + 8 <= count; i += 8) {
+        __m256 newVy = _mm256_add_ps(_mm256_loadu_ps(vy + i), gravity);
+        __m256 newLife = _mm256_sub_ps(_mm256_loadu_ps(life + i), one);
+        _mm256_storeu_ps(vy + i, newVy);
+        _mm256_storeu_ps(x + i, _mm256_add_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(vx + i)));
+        _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), newVy));
+        _mm256_storeu_ps(life + i, newLife);
+        // i 8'in katı: 8 bit aynı kelimeye düşer
+        dead[i >> 5] |= (uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(newLife, zero, _CMP_LE_OQ)) << (i & 31);
+    }
+#elif defined(PARTICLES_SSE2)
+    __m128 gravity = _mm_set1_ps(PARTICLE_GRAVITY), one = _mm_set1_ps(1.0f), zero = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4) {
+        __m128 newVy = _mm_add_ps(_mm_loadu_ps(vy + i), gravity);
+        __m128 newLife = _mm_sub_ps(_mm_loadu_ps(life + i), one);
+        _mm_storeu_ps(vy + i, newVy);
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_loadu_ps(vx + i)));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), newVy));
+        _mm_storeu_ps(life + i, newLife);
+        dead[i >> 5] |= (uint32_t)_mm_movemask_ps(_mm_cmple_ps(newLife, zero)) << (i & 31);
+    }
+#endif
+    for (; i < count; i++) {
+        vy[i] += PARTICLE_GRAVITY;
+        x[i] += vx[i];
+        y[i] += vy[i];
+        life[i] -= 1.0f;
+        if (life[i] <= 0.0f) dead[i >> 5] |= 1u << (i & 31);
+    }
+    RemoveDead(system);
+}
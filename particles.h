@@ -0,0 +1,52 @@
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+// Olay efektleri için parçacık havuzu. Parçacıklar structure-of-arrays
+// dizilerde sıkışık tutulur: canlılar [0, count) aralığındadır, ölen
+// parçacığın yerine sondaki taşınır. Tüm bellek InitParticleSystem'de
+// ayrılır; havuz doluysa yeni parçacıklar düşer. Güncelleme pencere veya
+// çizim çağırmaz, ekransız ölçülebilir; çizim particledraw.h'de.
+//
+// Konum/hız tick başına (dünya fiziğiyle aynı birim). Ömür tick olarak
+// azalır; son PARTICLE_FADE_TICKS tick'te saydamlaşır.
+
+#include "raylib.h"
+#include "world.h"
+#include <stdint.h>
+
+#define PARTICLE_GRAVITY 0.25f
+#define PARTICLE_FADE_TICKS 15.0f
+#define PARTICLE_SIZE 4.0f
+
+typedef enum ParticleEffect {
+    PARTICLE_BLOCK_DEBRIS,
+    PARTICLE_COIN_SPARKLE,
+    PARTICLE_STOMP_DUST,
+    PARTICLE_EFFECT_COUNT
+} ParticleEffect;
+
+typedef struct {
+    float* x;
+    float* y;
+    float* vx;
+    float* vy;
+    float* life;     // Kalan tick
+    uint8_t* effect; // Çizimde renk için
+    uint32_t* dead;  // Güncelleme sırasında ölenlerin bitset'i
+    int count;
+    int capacity;
+    uint32_t rng;
+} ParticleSystem;
+
+bool InitParticleSystem(ParticleSystem* system, int capacity, uint32_t seed);
+void FreeParticleSystem(ParticleSystem* system);
+void ClearParticles(ParticleSystem* system);
+
+// Efektin bir patlamasını rect içinden saçar; eklenen parçacık sayısını döner.
+int EmitParticles(ParticleSystem* system, ParticleEffect effect, Rectangle rect);
+// Dünyanın olay kaydındaki her olay için efekt üretir ve kaydı boşaltır.
+void EmitWorldEventParticles(ParticleSystem* system, WorldEventLog* events);
+// Tüm parçacıkları bir tick ilerletir ve ömrü bitenleri atar.
+void UpdateParticles(ParticleSystem* system);
+
+#endif
@@ -0,0 +1,193 @@
+#include "profiler.h"
+#include "thread.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER)
+#define PROFILE_THREAD_LOCAL __declspec(thread)
+#else
+#define PROFILE_THREAD_LOCAL _Thread_local
+#endif
+
+// Tek yazar (sahibi olan iş parçacığı), tek okur (ana iş parçacığı).
+// Yazar olayı doldurup written'ı release ile artırır; okur eski olayların
+// üzerine yazılmış olabileceğini written'ı tekrar okuyarak anlar.
+typedef struct {
+    ProfileEvent events[PROFILE_RING_SIZE];
+    volatile int written;  // Toplam yazılan olay (taşınca sarar, farklar yine doğru)
+    int read;              // Okurun kaldığı yer
+    uint64_t openStart[PROFILE_MAX_DEPTH];
+    uint16_t openZone[PROFILE_MAX_DEPTH];
+    int depth;
+    int generation;
+    uint16_t index;
+} ProfileRing;
+
+bool profilerEnabled = false;
+
+static ProfileRing* profileRings[PROFILE_MAX_THREADS];
+static volatile int profileRingCount;
+static volatile int profileGeneration;
+static PROFILE_THREAD_LOCAL ProfileRing* threadRing;
+
+static const char* zoneNames[PROFILE_ZONE_COUNT] = {
+    "Frame",
+    "PumpAssets",
+    "UpdateMusicStream",
+    "StepWorld",
+    "UpdateEnemies",
+    "UpdateFlowField",
+    "HandleCollisions",
+    "StreamLevel",
+    "Draw",
+    "DrawGameElements",
+    "UpdateStaticLayer",
+    "UpdateParticles",
+    "EndDrawing",
+    "Job"
+};
+
+const char* GetProfileZoneName(ProfileZone zone) {
+    return (zone >= 0 && zone < PROFILE_ZONE_COUNT) ? zoneNames[zone] : "?";
+}
+
+// İş parçacığının ilk bölgesinde tampon ayrılır; sınır aşılırsa o iş
+// parçacığı profillenmez
+static ProfileRing* GetThreadRing(void) {
+    ProfileRing* ring = threadRing;
+    if (ring == NULL) {
+        int slot = AtomicAdd(&profileRingCount, 1) - 1;
+        if (slot >= PROFILE_MAX_THREADS) return NULL;
+        ring = calloc(1, sizeof(ProfileRing));
+        if (ring == NULL) return NULL;
+        ring->index = (uint16_t)slot;
+        profileRings[slot] = ring;
+        threadRing = ring;
+    }
+    // Profilleyici kapalıyken açık kalan bölgeler unutulur
+    int generation = AtomicLoad(&profileGeneration);
+    if (ring->generation != generation) {
+        ring->generation = generation;
+        ring->depth = 0;
+    }
+    return ring;
+}
+
+void ProfileBegin(ProfileZone zone) {
+    ProfileRing* ring = GetThreadRing();
+    if (ring == NULL || ring->depth >= PROFILE_MAX_DEPTH) return;
+    ring->openZone[ring->depth] = (uint16_t)zone;
+    ring->openStart[ring->depth] = GetMonotonicNs();
+    ring->depth++;
+}
+
+void ProfileEnd(ProfileZone zone) {
+    uint64_t end = GetMonotonicNs();
+    ProfileRing* ring = GetThreadRing();
+    if (ring == NULL || ring->depth == 0 || ring->openZone[ring->depth - 1] != zone) return;
+    ring->depth--;
+
+    int written = ring->written;
+    ProfileEvent* event = &ring->events[written & (PROFILE_RING_SIZE - 1)];
+    event->start = ring->openStart[ring->depth];
+    event->end = end;
+    event->zone = (uint16_t)zone;
+    event->thread = ring->index;
+    AtomicStore(&ring->written, written + 1);
+}
+
+void SetProfilerEnabled(bool enabled) {
+    if (enabled && !profilerEnabled) AtomicAdd(&profileGeneration, 1);
+    profilerEnabled = enabled;
+}
+
+static void CaptureEvent(ProfilerStats* stats, const ProfileEvent* event) {
+    if (stats->captureCount == stats->captureCapacity) {
+        int capacity = stats->captureCapacity > 0 ? stats->captureCapacity * 2 : 4096;
+        ProfileEvent* grown = realloc(stats->capture, sizeof(ProfileEvent) * capacity);
+        if (grown == NULL) return;
+        stats->capture = grown;
+        stats->captureCapacity = capacity;
+    }
+    stats->capture[stats->captureCount++] = *event;
+}
+
+bool ProfilerEndFrame(ProfilerStats* stats) {
+    double zoneNs[PROFILE_ZONE_COUNT] = { 0 };
+
+    int ringCount = AtomicLoad(&profileRingCount);
+    if (ringCount > PROFILE_MAX_THREADS) ringCount = PROFILE_MAX_THREADS;
+    for (int r = 0; r < ringCount; r++) {
+        ProfileRing* ring = profileRings[r];
+        if (ring == NULL) continue;
+        int written = AtomicLoad(&ring->written);
+        // Okur geride kaldıysa yalnızca halkada kalan son olaylar okunur
+        if (written - ring->read > PROFILE_RING_SIZE) ring->read = written - PROFILE_RING_SIZE;
+        for (; ring->read != written; ring->read++) {
+            ProfileEvent event = ring->events[ring->read & (PROFILE_RING_SIZE - 1)];
+            // Kopyalarken yazar bu slotu geçtiyse olay bozuk olabilir
+            if (AtomicLoad(&ring->written) - ring->read >= PROFILE_RING_SIZE) continue;
+            zoneNs[event.zone] += (double)(event.end - event.start);
+            if (stats->captureFramesLeft > 0) CaptureEvent(stats, &event);
+        }
+    }
+
+    stats->historyIndex = (stats->historyIndex + 1) % PROFILE_HISTORY;
+    for (int z = 0; z < PROFILE_ZONE_COUNT; z++) {
+        stats->zoneMs[z][stats->historyIndex] = (float)(zoneNs[z] / 1e6);
+    }
+    if (stats->frameCount < PROFILE_HISTORY) stats->frameCount++;
+
+    if (stats->captureFramesLeft > 0 && --stats->captureFramesLeft == 0) {
+        WriteProfilerTrace(stats, stats->capturePath);
+        stats->captureCount = 0;
+        return true;
+    }
+    return false;
+}
+
+void ProfilerCaptureFrames(ProfilerStats* stats, int frameCount, const char* path) {
+    snprintf(stats->capturePath, sizeof(stats->capturePath), "%s", path);
+    stats->captureCount = 0;
+    stats->captureFramesLeft = frameCount;
+}
+
+// Trace-event formatı: "X" (complete) olayları, zaman birimi mikrosaniye
+bool WriteProfilerTrace(const ProfilerStats* stats, const char* path) {
+    FILE* file = fopen(path, "w");
+    if (file == NULL) return false;
+
+    uint64_t origin = UINT64_MAX;
+    for (int i = 0; i < stats->captureCount; i++) {
+        if (stats->capture[i].start < origin) origin = stats->capture[i].start;
+    }
+    fprintf(file, "{\"traceEvents\":[\n");
+    for (int i = 0; i < stats->captureCount; i++) {
+        const ProfileEvent* event = &stats->capture[i];
+        fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+            i == 0 ? "" : ",\n", GetProfileZoneName((ProfileZone)event->zone), event->thread,
+            (double)(event->start - origin) / 1000.0, (double)(event->end - event->start) / 1000.0);
+    }
+    fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    bool ok = ferror(file) == 0;
+    fclose(file);
+    return ok;
+}
+
+void FreeProfilerStats(ProfilerStats* stats) {
+    free(stats->capture);
+    stats->capture = NULL;
+    stats->captureCount = stats->captureCapacity = 0;
+    stats->captureFramesLeft = 0;
+}
+
+float GetProfileZoneAverage(const ProfilerStats* stats, ProfileZone zone, int count) {
+    if (count > stats->frameCount) count = stats->frameCount;
+    if (count <= 0) return 0.0f;
+    float total = 0.0f;
+    for (int i = 0; i < count; i++) {
+        total += stats->zoneMs[zone][(stats->historyIndex - i + PROFILE_HISTORY) % PROFILE_HISTORY];
+    }
+    return total / count;
+}
@@ -0,0 +1,85 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+// Kare profilleyici: ana döngünün aşamaları PROFILE_BEGIN/PROFILE_END ile
+// işaretlenir. Her iş parçacığı kendi halka tamponuna kilitsiz yazar; ana
+// iş parçacığı kare sonunda ProfilerEndFrame ile tamponları okur, bölge
+// başına kare süresi geçmişini günceller ve istenirse Chrome trace olarak
+// kaydeder. Kapalıyken maliyet tek bir dallanmadır; ALGOLAB_NO_PROFILER
+// tanımlanırsa makrolar tamamen kaybolur.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define PROFILE_HISTORY 120      // HUD grafiğindeki kare sayısı
+#define PROFILE_MAX_THREADS 16
+#define PROFILE_RING_SIZE 16384  // İş parçacığı başına olay, 2'nin kuvveti
+#define PROFILE_MAX_DEPTH 32     // İç içe bölge sınırı
+
+typedef enum ProfileZone {
+    PROFILE_FRAME,
+    PROFILE_ASSETS,
+    PROFILE_MUSIC,
+    PROFILE_STEP,
+    PROFILE_ENEMIES,
+    PROFILE_FLOW_FIELD,
+    PROFILE_COLLISIONS,
+    PROFILE_STREAM,
+    PROFILE_DRAW,
+    PROFILE_DRAW_ELEMENTS,
+    PROFILE_STATIC_LAYER,
+    PROFILE_PARTICLES,
+    PROFILE_END_DRAWING,
+    PROFILE_JOB,
+    PROFILE_ZONE_COUNT
+} ProfileZone;
+
+typedef struct {
+    uint64_t start; // GetMonotonicNs
+    uint64_t end;
+    uint16_t zone;
+    uint16_t thread;
+} ProfileEvent;
+
+// Yalnızca ana iş parçacığı okur/yazar
+typedef struct {
+    float zoneMs[PROFILE_ZONE_COUNT][PROFILE_HISTORY]; // Kare başına bölgede geçen süre
+    int historyIndex;                                  // Son yazılan kare
+    int frameCount;
+
+    ProfileEvent* capture; // Kaydedilen kareler boyunca toplanan olaylar
+    int captureCount;
+    int captureCapacity;
+    int captureFramesLeft;
+    char capturePath[260];
+} ProfilerStats;
+
+extern bool profilerEnabled;
+
+const char* GetProfileZoneName(ProfileZone zone);
+
+void ProfileBegin(ProfileZone zone);
+void ProfileEnd(ProfileZone zone);
+
+#if defined(ALGOLAB_NO_PROFILER)
+#define PROFILE_BEGIN(zone) ((void)0)
+#define PROFILE_END(zone) ((void)0)
+#else
+#define PROFILE_BEGIN(zone) do { if (profilerEnabled) ProfileBegin(zone); } while (0)
+#define PROFILE_END(zone) do { if (profilerEnabled) ProfileEnd(zone); } while (0)
+#endif
+
+void SetProfilerEnabled(bool enabled);
+// Ana iş parçacığında, her kare sonunda çağrılır. Kayıt bittiyse dosya
+// yazılır ve true döner.
+bool ProfilerEndFrame(ProfilerStats* stats);
+// Sonraki frameCount kareyi kaydeder; bitince path'e Chrome trace-event
+// JSON yazılır (chrome://tracing veya Perfetto ile açılır).
+void ProfilerCaptureFrames(ProfilerStats* stats, int frameCount, const char* path);
+bool WriteProfilerTrace(const ProfilerStats* stats, const char* path);
+void FreeProfilerStats(ProfilerStats* stats);
+
+// Son count karedeki ortalama (ms)
+float GetProfileZoneAverage(const ProfilerStats* stats, ProfileZone zone, int count);
+
+#endif
@@ -0,0 +1,53 @@
+#include "profilerhud.h"
+
+#define HUD_ROW_HEIGHT 18
+#define HUD_LABEL_WIDTH 190
+#define HUD_GRAPH_SCALE_MS 16.7f // Grafiğin tam yüksekliği: 60 FPS kare bütçesi
+
+int DrawProfilerOverlay(const ProfilerStats* stats, int x, int y) {
+    int width = HUD_LABEL_WIDTH + PROFILE_HISTORY + 8;
+    int height = PROFILE_ZONE_COUNT * HUD_ROW_HEIGHT + 8;
+    DrawRectangle(x, y, width, height, Fade(BLACK, 0.6f));
+
+    for (int z = 0; z < PROFILE_ZONE_COUNT; z++) {
+        int rowY = y + 4 + z * HUD_ROW_HEIGHT;
+        float average = GetProfileZoneAverage(stats, (ProfileZone)z, 60);
+        DrawText(TextFormat("%-18s %6.2f ms", GetProfileZoneName((ProfileZone)z), average), x + 4, rowY + 4, 10, RAYWHITE);
+
+        // En eski kare solda, en yeni sağda
+        int graphX = x + HUD_LABEL_WIDTH;
+        int graphHeight = HUD_ROW_HEIGHT - 2;
+        for (int i = 0; i < stats->frameCount; i++) {
+            int index = (stats->historyIndex - i + PROFILE_HISTORY) % PROFILE_HISTORY;
+            float ms = stats->zoneMs[z][index];
+            int barHeight = (int)(ms / HUD_GRAPH_SCALE_MS * graphHeight + 0.5f);
+            if (barHeight > graphHeight) barHeight = graphHeight;
+            if (barHeight <= 0) continue;
+            Color color = (ms > HUD_GRAPH_SCALE_MS) ? RED : (z == PROFILE_FRAME ? YELLOW : LIME);
+            DrawRectangle(graphX + PROFILE_HISTORY - 1 - i, rowY + graphHeight - barHeight, 1, barHeight, color);
+        }
+    }
+    return y + height;
+}
+
+int DrawFrameTimingOverlay(const FrameClock* clock, int x, int y) {
+    FrameTimingStats stats;
+    GetFrameTimingStats(clock, &stats);
+    int width = HUD_LABEL_WIDTH + PROFILE_HISTORY + 8;
+    int height = 4 * HUD_ROW_HEIGHT + 8;
+    DrawRectangle(x, y, width, height, Fade(BLACK, 0.6f));
+
+    int rowY = y + 8;
+    DrawText(TextFormat("kare   %6.2f ms  sapma %5.2f  en fazla %6.2f", stats.frameMs, stats.frameJitterMs, stats.frameMaxMs),
+        x + 4, rowY, 10, RAYWHITE);
+    rowY += HUD_ROW_HEIGHT;
+    DrawText(TextFormat("tick   %6.2f ms  sapma %5.2f  gecikme %5.2f / %5.2f", stats.tickMs, stats.tickJitterMs,
+        stats.tickLateMs, stats.tickLateMaxMs), x + 4, rowY, 10, RAYWHITE);
+    rowY += HUD_ROW_HEIGHT;
+    DrawText(TextFormat("girdi  %6.2f ms  en fazla %6.2f  (%d ornek)", stats.inputLatencyMs, stats.inputLatencyMaxMs,
+        stats.inputSamples), x + 4, rowY, 10, RAYWHITE);
+    rowY += HUD_ROW_HEIGHT;
+    DrawText(TextFormat("%llu tick, %llu atlandi", (unsigned long long)stats.ticks, (unsigned long long)stats.droppedTicks),
+        x + 4, rowY, 10, stats.droppedTicks > 0 ? ORANGE : RAYWHITE);
+    return y + height;
+}
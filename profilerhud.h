@@ -0,0 +1,16 @@
+#ifndef PROFILERHUD_H
+#define PROFILERHUD_H
+
+// Profilleyici HUD'u: bölge başına son PROFILE_HISTORY karenin süre
+// grafiği ve ortalaması, altında kare/tick zamanlaması ve girdi gecikmesi.
+// Ekran koordinatlarında, EndMode2D'den sonra çizilir.
+
+#include "raylib.h"
+#include "frameclock.h"
+#include "profiler.h"
+
+// Paneller alt kenarlarının y'sini döner; sonraki panel oradan başlar.
+int DrawProfilerOverlay(const ProfilerStats* stats, int x, int y);
+int DrawFrameTimingOverlay(const FrameClock* clock, int x, int y);
+
+#endif
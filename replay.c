@@ -0,0 +1,210 @@
+#include "replay.h"
+#include "profiler.h"
+#include "thread.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+uint8_t PackInput(WorldInput input) {
+    return (uint8_t)((input.left ? REPLAY_INPUT_LEFT : 0) | (input.right ? REPLAY_INPUT_RIGHT : 0) |
+        (input.jump ? REPLAY_INPUT_JUMP : 0));
+}
+
+WorldInput UnpackInput(uint8_t bits) {
+    WorldInput input = { (bits & REPLAY_INPUT_LEFT) != 0, (bits & REPLAY_INPUT_RIGHT) != 0, (bits & REPLAY_INPUT_JUMP) != 0 };
+    return input;
+}
+
+static uint32_t HashBytes(uint32_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+uint32_t HashWorld(const World* world) {
+    uint32_t hash = 2166136261u;
+    // Alan alan: yapı dolgusu (padding) hash'e karışmasın
+    hash = HashBytes(hash, &world->marioPosition, sizeof(world->marioPosition));
+    hash = HashBytes(hash, &world->velocityY, sizeof(world->velocityY));
+    hash = HashBytes(hash, &world->isJumping, sizeof(world->isJumping));
+    hash = HashBytes(hash, &world->marioDirection, sizeof(world->marioDirection));
+    hash = HashBytes(hash, &world->walkFrame, sizeof(world->walkFrame));
+    hash = HashBytes(hash, &world->walkFrameCounter, sizeof(world->walkFrameCounter));
+    hash = HashBytes(hash, &world->score, sizeof(world->score));
+    hash = HashBytes(hash, &world->tick, sizeof(world->tick));
+
+    const EnemySet* enemies = &world->enemies;
+    hash = HashBytes(hash, enemies->x, sizeof(float) * enemies->count);
+    hash = HashBytes(hash, enemies->y, sizeof(float) * enemies->count);
+    hash = HashBytes(hash, enemies->velocityY, sizeof(float) * enemies->count);
+    hash = HashBytes(hash, enemies->direction, sizeof(int8_t) * enemies->count);
+    hash = HashBytes(hash, enemies->active, sizeof(uint32_t) * FLAG_WORDS(enemies->count));
+    hash = HashBytes(hash, enemies->lastTick, sizeof(uint32_t) * enemies->count);
+    hash = HashBytes(hash, world->blocks.hit, sizeof(uint32_t) * FLAG_WORDS(world->blocks.count));
+    hash = HashBytes(hash, world->coins.collected, sizeof(uint32_t) * FLAG_WORDS(world->coins.count));
+    return hash;
+}
+
+bool InitGameWorld(World* world, Level* level, const char* levelPath, int groundY, bool* isStreaming) {
+    *isStreaming = levelPath != NULL && OpenLevel(level, levelPath);
+    if (*isStreaming) {
+        if (!InitLevelWorld(world, level, groundY) || !InitLevelNav(world, level)) {
+            FreeWorld(world);
+            CloseLevel(level);
+            return false;
+        }
+        StreamLevel(level, world, world->marioPosition.x);
+        return true;
+    }
+    if (!InitWorld(world, groundY, MAX_BLOCKS, MAX_ENEMIES, MAX_COINS)) return false;
+    InitLevel(&world->blocks, &world->enemies, &world->coins, world->groundY);
+    BuildWorldGrids(world);
+    if (!InitWorldNavFromBlocks(world)) {
+        FreeWorld(world);
+        return false;
+    }
+    return true;
+}
+
+void FreeGameWorld(World* world, Level* level, bool isStreaming) {
+    FreeWorld(world);
+    if (isStreaming) CloseLevel(level);
+}
+
+void StepGameTick(World* world, Level* level, bool isStreaming, WorldInput input) {
+    StepWorld(world, input);
+    if (isStreaming) {
+        // Kamera Mario'nun ortasını takip eder
+        PROFILE_BEGIN(PROFILE_STREAM);
+        StreamLevel(level, world, world->marioPosition.x + MARIO_WALK_FRAME_WIDTH / 2);
+        PROFILE_END(PROFILE_STREAM);
+    }
+}
+
+void StepGameTicks(World* world, Level* level, bool isStreaming, WorldInput input, int ticks) {
+    if (!isStreaming) {
+        StepWorldTicks(world, input, ticks);
+        return;
+    }
+    while (ticks > 0) {
+        // Mario tick başına en çok MARIO_SPEED ilerler; kamera parçası son tick'e kadar değişmez
+        float chunkWidth = (float)level->header->chunkWidth;
+        float focusX = world->marioPosition.x + MARIO_WALK_FRAME_WIDTH / 2;
+        float left = focusX - floorf(focusX / chunkWidth) * chunkWidth;
+        float margin = fminf(left, chunkWidth - left);
+        int safe = 1 + (int)floorf((margin - 1e-3f) / MARIO_SPEED);
+        if (safe < 1) safe = 1;
+        if (safe > ticks) safe = ticks;
+        StepWorldTicks(world, input, safe);
+        PROFILE_BEGIN(PROFILE_STREAM);
+        StreamLevel(level, world, world->marioPosition.x + MARIO_WALK_FRAME_WIDTH / 2);
+        PROFILE_END(PROFILE_STREAM);
+        input.jump = false;
+        ticks -= safe;
+    }
+}
+
+bool BeginRecording(ReplayRecorder* recorder, const char* path, uint32_t seed, int groundY, const char* levelName) {
+    memset(recorder, 0, sizeof(*recorder));
+    memcpy(recorder->header.magic, REPLAY_MAGIC, 4);
+    recorder->header.version = REPLAY_VERSION;
+    recorder->header.seed = seed;
+    recorder->header.groundY = groundY;
+    if (levelName != NULL) {
+        strncpy(recorder->header.level, levelName, REPLAY_LEVEL_NAME_MAX - 1);
+    }
+
+    recorder->file = fopen(path, "wb");
+    if (recorder->file == NULL) return false;
+    // tickCount kapanışta yazılır; çökmede 0 kalır ve okuyucu dosya boyunu kullanır
+    if (fwrite(&recorder->header, sizeof(recorder->header), 1, recorder->file) != 1) {
+        fclose(recorder->file);
+        recorder->file = NULL;
+        return false;
+    }
+    return true;
+}
+
+void RecordTick(ReplayRecorder* recorder, WorldInput input, const World* world) {
+    if (recorder->file == NULL) return;
+    uint8_t bits = PackInput(input);
+    uint32_t hash = HashWorld(world);
+    fwrite(&bits, 1, 1, recorder->file);
+    fwrite(&hash, sizeof(hash), 1, recorder->file);
+    recorder->header.tickCount++;
+    // Saha hatalarında kayıt çökmeden önceki son saniyeyi de içersin
+    if (recorder->header.tickCount % 60 == 0) fflush(recorder->file);
+}
+
+void EndRecording(ReplayRecorder* recorder) {
+    if (recorder->file == NULL) return;
+    fseek(recorder->file, 0, SEEK_SET);
+    fwrite(&recorder->header, sizeof(recorder->header), 1, recorder->file);
+    fclose(recorder->file);
+    recorder->file = NULL;
+}
+
+bool LoadReplay(Replay* replay, const char* path) {
+    memset(replay, 0, sizeof(*replay));
+    MappedFile file;
+    if (!MapFile(&file, path)) return false;
+
+    bool ok = false;
+    const uint8_t* data = file.data;
+    if (file.size >= sizeof(ReplayHeader)) {
+        memcpy(&replay->header, data, sizeof(ReplayHeader));
+        size_t available = (file.size - sizeof(ReplayHeader)) / REPLAY_TICK_SIZE;
+        if (replay->header.tickCount == 0 || replay->header.tickCount > available) replay->header.tickCount = (uint32_t)available;
+        replay->header.level[REPLAY_LEVEL_NAME_MAX - 1] = '\0';
+        ok = memcmp(replay->header.magic, REPLAY_MAGIC, 4) == 0 && replay->header.version == REPLAY_VERSION;
+    }
+    if (ok) {
+        int count = (int)replay->header.tickCount;
+        replay->inputs = malloc(count > 0 ? count : 1);
+        replay->hashes = malloc(sizeof(uint32_t) * (count > 0 ? count : 1));
+        ok = replay->inputs != NULL && replay->hashes != NULL;
+        const uint8_t* tick = data + sizeof(ReplayHeader);
+        for (int i = 0; ok && i < count; i++, tick += REPLAY_TICK_SIZE) {
+            replay->inputs[i] = tick[0];
+            memcpy(&replay->hashes[i], tick + 1, sizeof(uint32_t));
+        }
+    }
+    UnmapFile(&file);
+    if (!ok) FreeReplay(replay);
+    return ok;
+}
+
+void FreeReplay(Replay* replay) {
+    free(replay->inputs);
+    free(replay->hashes);
+    replay->inputs = NULL;
+    replay->hashes = NULL;
+}
+
+int PlayReplay(const Replay* replay, World* world, Level* level, bool isStreaming, uint64_t* tickNs) {
+    int firstMismatch = -1;
+    for (int tick = 0; tick < (int)replay->header.tickCount; tick++) {
+        uint64_t start = tickNs != NULL ? GetMonotonicNs() : 0;
+        StepGameTick(world, level, isStreaming, UnpackInput(replay->inputs[tick]));
+        if (tickNs != NULL) tickNs[tick] = GetMonotonicNs() - start;
+        if (firstMismatch == -1 && HashWorld(world) != replay->hashes[tick]) firstMismatch = tick;
+    }
+    return firstMismatch;
+}
+
+int PlayReplayRuns(const Replay* replay, World* world, Level* level, bool isStreaming) {
+    int tickCount = (int)replay->header.tickCount;
+    int tick = 0;
+    while (tick < tickCount) {
+        uint8_t held = replay->inputs[tick] & (uint8_t)~REPLAY_INPUT_JUMP;
+        int end = tick + 1;
+        while (end < tickCount && replay->inputs[end] == held) end++;
+        StepGameTicks(world, level, isStreaming, UnpackInput(replay->inputs[tick]), end - tick);
+        if (HashWorld(world) != replay->hashes[end - 1]) return end - 1;
+        tick = end;
+    }
+    return -1;
+}
@@ -0,0 +1,82 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+// Deterministik girdi kaydı ve tekrar oynatma. Oyun yalnızca tick başına
+// girdiye bağlı olduğu için (fizik kare tabanlı, rastgelelik tohumlu)
+// aynı başlangıç dünyası ve aynı girdi akışı her seferinde aynı durumu
+// üretir. Kayıt her tick için paketlenmiş girdiyi ve o tick sonundaki
+// durum özetini (hash) tutar; oynatma ilk ayrıştığı tick'i bildirir.
+//
+// Dosya düzeni (little-endian):
+//   ReplayHeader
+//   her tick için: uint8_t girdi bitleri, uint32_t durum hash'i
+
+#include "level.h"
+#include "world.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#define REPLAY_MAGIC "ARPL"
+#define REPLAY_VERSION 5 // 2: düşman LOD'u, 3: kovalayan düşmanlar, 4: düşman takvimi, 5: kovalama menzili; eski kayıtlar tutmaz
+#define REPLAY_LEVEL_NAME_MAX 64
+#define REPLAY_TICK_SIZE 5
+
+#define REPLAY_INPUT_LEFT  0x1
+#define REPLAY_INPUT_RIGHT 0x2
+#define REPLAY_INPUT_JUMP  0x4
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t seed;
+    uint32_t tickCount;  // Kayıt yarıda kesildiyse 0; dosya boyundan bulunur
+    int32_t groundY;
+    char level[REPLAY_LEVEL_NAME_MAX]; // Kaynak köküne göre parkur dosyası, boşsa gömülü mini level
+} ReplayHeader;
+
+typedef struct {
+    FILE* file;
+    ReplayHeader header;
+} ReplayRecorder;
+
+typedef struct {
+    ReplayHeader header;
+    uint8_t* inputs;
+    uint32_t* hashes;
+} Replay;
+
+uint8_t PackInput(WorldInput input);
+WorldInput UnpackInput(uint8_t bits);
+
+// Simülasyon durumunun özeti (FNV-1a): Mario, skor, düşman konum/hızları ve
+// parkurdaki vurulan/toplanan bayrakları.
+uint32_t HashWorld(const World* world);
+
+// Başlangıç dünyası: levelPath açılabiliyorsa akışlı parkur, değilse (veya
+// NULL ise) gömülü mini level. Oyun ve oynatma aynı yolu kullanır; ikisinde
+// de düşmanlar gezinme ızgarasıyla Mario'yu kovalar.
+bool InitGameWorld(World* world, Level* level, const char* levelPath, int groundY, bool* isStreaming);
+void FreeGameWorld(World* world, Level* level, bool isStreaming);
+// Oyunun tek tick'i: dünya adımı ve kameranın etrafındaki parçaların akışı.
+void StepGameTick(World* world, Level* level, bool isStreaming, WorldInput input);
+// ticks kez StepGameTick ile aynı sonucu verir (zıplama yalnızca ilk tick'te).
+// Akışlı parkurda adım, kamera parça sınırını geçebileceği yerde bölünür.
+void StepGameTicks(World* world, Level* level, bool isStreaming, WorldInput input, int ticks);
+
+bool BeginRecording(ReplayRecorder* recorder, const char* path, uint32_t seed, int groundY, const char* levelName);
+// StepGameTick'ten hemen sonra çağrılır
+void RecordTick(ReplayRecorder* recorder, WorldInput input, const World* world);
+void EndRecording(ReplayRecorder* recorder);
+
+bool LoadReplay(Replay* replay, const char* path);
+void FreeReplay(Replay* replay);
+
+// Kaydı world üzerinde en yüksek hızda oynatır. tickNs NULL değilse tick
+// süreleri yazılır. Tüm hash'ler tutarsa -1, değilse ilk ayrışan tick döner.
+int PlayReplay(const Replay* replay, World* world, Level* level, bool isStreaming, uint64_t* tickNs);
+// Girdinin değişmediği tick dizilerini (zıplama yalnızca dizi başında)
+// StepGameTicks ile tek adımda oynatır; hash'ler dizi sonlarında
+// karşılaştırılır. Ayrışma varsa fark edildiği dizinin son tick'i döner.
+int PlayReplayRuns(const Replay* replay, World* world, Level* level, bool isStreaming);
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef RNG_H
+#define RNG_H
+
+// Platformdan bağımsız, tohumlanabilir rastgele sayı üreteci (xorshift32).
+// rand() yerine kullanılır; aynı tohum her makinede aynı diziyi verir.
+
+#include <stdint.h>
+
+// Durum 0 olmamalı
+static inline uint32_t NextRandom(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+// [lo, hi] aralığında
+static inline int RandomRange(uint32_t* state, int lo, int hi) {
+    return lo + (int)(NextRandom(state) % (uint32_t)(hi - lo + 1));
+}
+
+#endif
@@ -0,0 +1,69 @@
+#include "rollback.h"
+#include "replay.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Basılı tuşlar sürer; zıplama tek tick'lik basış olduğu için tahmin edilmez
+static uint8_t PredictInput(uint8_t confirmed) {
+    return (uint8_t)(confirmed & ~REPLAY_INPUT_JUMP);
+}
+
+static uint8_t* GetFrame(const RollbackSession* session, uint32_t tick) {
+    return session->frames + (size_t)(tick % ROLLBACK_WINDOW) * session->layout.size;
+}
+
+bool InitRollbackSession(RollbackSession* session, World* world, Level* level, bool isStreaming) {
+    memset(session, 0, sizeof(*session));
+    session->world = world;
+    session->level = level;
+    session->isStreaming = isStreaming;
+    InitSnapshotLayout(&session->layout, world, isStreaming ? level : NULL);
+    session->frames = malloc(session->layout.size * ROLLBACK_WINDOW);
+    return session->frames != NULL;
+}
+
+void FreeRollbackSession(RollbackSession* session) {
+    free(session->frames);
+    memset(session, 0, sizeof(*session));
+}
+
+static void SimulateTick(RollbackSession* session, uint32_t tick) {
+    CaptureSnapshot(&session->layout, GetFrame(session, tick));
+    StepGameTick(session->world, session->level, session->isStreaming, UnpackInput(session->inputs[tick % ROLLBACK_WINDOW]));
+}
+
+bool AdvanceRollback(RollbackSession* session) {
+    uint32_t tick = session->simulatedTicks;
+    if (tick >= session->confirmedTicks) {
+        // Görüntüsü üzerine yazılacak tick hâlâ geri alınabilir olmalı
+        if (tick - session->confirmedTicks >= ROLLBACK_WINDOW) return false;
+        session->inputs[tick % ROLLBACK_WINDOW] = PredictInput(session->lastConfirmed);
+        session->stats.predictedTicks++;
+    }
+    SimulateTick(session, tick);
+    session->simulatedTicks++;
+    return true;
+}
+
+bool ConfirmRollbackInput(RollbackSession* session, WorldInput input) {
+    uint32_t tick = session->confirmedTicks;
+    if (tick >= session->simulatedTicks && tick - session->simulatedTicks >= ROLLBACK_WINDOW) return false;
+    uint8_t bits = PackInput(input);
+    session->confirmedTicks++;
+    session->lastConfirmed = bits;
+
+    uint8_t* slot = &session->inputs[tick % ROLLBACK_WINDOW];
+    if (tick >= session->simulatedTicks || *slot == bits) {
+        *slot = bits;
+        return true;
+    }
+
+    // Tahmin tutmadı: tick'in başına dön, sonraki tahminleri yeni girdiden yenile
+    *slot = bits;
+    RestoreSnapshot(&session->layout, GetFrame(session, tick));
+    for (uint32_t t = tick + 1; t < session->simulatedTicks; t++) session->inputs[t % ROLLBACK_WINDOW] = PredictInput(bits);
+    for (uint32_t t = tick; t < session->simulatedTicks; t++) SimulateTick(session, t);
+    session->stats.rollbacks++;
+    session->stats.resimulatedTicks += session->simulatedTicks - tick;
+    return true;
+}
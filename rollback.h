@@ -0,0 +1,49 @@
+#ifndef ROLLBACK_H
+#define ROLLBACK_H
+
+// Rollback tarzı ağ oyunu için tahmin ve geri alma. Mario'yu yöneten girdi
+// eşten gecikmeli ve sırayla gelir; girdisi henüz gelmemiş tick'ler son
+// onaylı girdiyle tahmin edilerek (tuşlar basılı kalır, zıplama yok)
+// beklemeden simüle edilir. Onaylı girdi tahminden farklı çıkarsa o tick'in
+// başındaki görüntüye dönülür ve şu ana kadarki tick'ler yeniden simüle
+// edilir. Görüntüler ROLLBACK_WINDOW yuvalık sabit dizide tutulur; tahmin
+// bu pencereyi aşacaksa simülasyon girdi gelene kadar bekler.
+
+#include "level.h"
+#include "snapshot.h"
+#include "world.h"
+#include <stdint.h>
+
+#define ROLLBACK_WINDOW 16
+
+typedef struct {
+    uint64_t rollbacks;
+    uint64_t resimulatedTicks;
+    uint64_t predictedTicks;
+} RollbackStats;
+
+typedef struct {
+    World* world;
+    Level* level;
+    bool isStreaming;
+    SnapshotLayout layout;
+    uint8_t* frames;                  // tick % ROLLBACK_WINDOW yuvasında o tick'in başındaki görüntü
+    uint8_t inputs[ROLLBACK_WINDOW];  // Tick'te uygulanan (onaylı ya da tahmini) girdi bitleri
+    uint32_t simulatedTicks;          // Oturum başından beri simüle edilen tick
+    uint32_t confirmedTicks;          // Girdisi gelmiş tick; her zaman sıradaki tick'e gelir
+    uint8_t lastConfirmed;
+    RollbackStats stats;
+} RollbackSession;
+
+bool InitRollbackSession(RollbackSession* session, World* world, Level* level, bool isStreaming);
+void FreeRollbackSession(RollbackSession* session);
+
+// Sıradaki tick'i onaylı girdiyle, yoksa tahminle simüle eder. Tahmin
+// penceresi doluysa hiçbir şey yapmadan false döner.
+bool AdvanceRollback(RollbackSession* session);
+// Onaylanmamış ilk tick'in girdisini bildirir. Tick simüle edildiyse ve
+// tahmin tutmadıysa geri alıp yeniden simüle eder. Girdi pencereden
+// ileride kalıyorsa reddedilir (false).
+bool ConfirmRollbackInput(RollbackSession* session, WorldInput input);
+
+#endif
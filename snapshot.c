@@ -0,0 +1,403 @@
+#include "snapshot.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static size_t AlignUp4(size_t n) {
+    return (n + 3) & ~(size_t)3;
+}
+
+static void AddRegion(SnapshotLayout* layout, void* data, size_t size, bool drawn) {
+    if (size == 0) return;
+    SnapshotRegion* region = &layout->regions[layout->regionCount++];
+    region->data = data;
+    region->size = (uint32_t)size;
+    region->drawn = drawn;
+    layout->size += AlignUp4(size);
+}
+
+static void AddGridRegions(SnapshotLayout* layout, SpatialHash* grid) {
+    size_t items = grid->capacity > 0 ? grid->capacity : 1;
+    AddRegion(layout, grid->heads, sizeof(int) * (grid->bucketMask + 1), false);
+    AddRegion(layout, grid->next, sizeof(int) * items, false);
+    AddRegion(layout, grid->cellX, sizeof(int) * items, false);
+    AddRegion(layout, grid->cellY, sizeof(int) * items, false);
+    AddRegion(layout, grid->inserted, sizeof(bool) * items, false);
+}
+
+void InitSnapshotLayout(SnapshotLayout* layout, World* world, Level* level) {
+    memset(layout, 0, sizeof(*layout));
+    layout->world = world;
+    layout->level = level;
+    layout->size = sizeof(SnapshotState);
+
+    BlockSet* blocks = &world->blocks;
+    EnemySet* enemies = &world->enemies;
+    CoinSet* coins = &world->coins;
+    size_t blockCount = blocks->count, enemyCount = enemies->count, coinCount = coins->count;
+
+    // Her tick değişebilenler
+    AddRegion(layout, enemies->x, sizeof(float) * enemyCount, false);
+    AddRegion(layout, enemies->y, sizeof(float) * enemyCount, false);
+    AddRegion(layout, enemies->velocityY, sizeof(float) * enemyCount, false);
+    AddRegion(layout, enemies->direction, sizeof(int8_t) * enemyCount, false);
+    AddRegion(layout, enemies->active, sizeof(uint32_t) * FLAG_WORDS(enemyCount), false);
+    AddRegion(layout, enemies->lastTick, sizeof(uint32_t) * enemyCount, false);
+    AddRegion(layout, enemies->wakeTick, sizeof(uint32_t) * enemyCount, false);
+    AddRegion(layout, blocks->hit, sizeof(uint32_t) * FLAG_WORDS(blockCount), true);
+    AddRegion(layout, coins->collected, sizeof(uint32_t) * FLAG_WORDS(coinCount), false);
+    AddGridRegions(layout, &world->enemyGrid);
+    AddGridRegions(layout, &world->coinGrid);
+    if (level == NULL) return;
+
+    // Akışlı parkur: yuvalar parça yüklendikçe yeniden yazılır
+    AddRegion(layout, blocks->x, sizeof(float) * blockCount, true);
+    AddRegion(layout, blocks->y, sizeof(float) * blockCount, true);
+    AddRegion(layout, blocks->width, sizeof(float) * blockCount, true);
+    AddRegion(layout, blocks->height, sizeof(float) * blockCount, true);
+    AddRegion(layout, blocks->sprite, sizeof(uint8_t) * blockCount, true);
+    AddRegion(layout, blocks->stone, sizeof(uint32_t) * FLAG_WORDS(blockCount), true);
+    AddRegion(layout, blocks->hasCoin, sizeof(uint32_t) * FLAG_WORDS(blockCount), false);
+    AddRegion(layout, enemies->width, sizeof(float) * enemyCount, false);
+    AddRegion(layout, enemies->height, sizeof(float) * enemyCount, false);
+    AddRegion(layout, enemies->speed, sizeof(float) * enemyCount, false);
+    AddRegion(layout, enemies->sprite, sizeof(uint8_t) * enemyCount, false);
+    AddRegion(layout, coins->x, sizeof(float) * coinCount, false);
+    AddRegion(layout, coins->y, sizeof(float) * coinCount, false);
+    AddRegion(layout, coins->width, sizeof(float) * coinCount, false);
+    AddRegion(layout, coins->height, sizeof(float) * coinCount, false);
+    AddRegion(layout, coins->sprite, sizeof(uint8_t) * coinCount, false);
+    AddGridRegions(layout, &world->blockGrid);
+
+    const LevelHeader* header = level->header;
+    AddRegion(layout, level->residentChunk, sizeof(level->residentChunk), false);
+    AddRegion(layout, level->blockHit, sizeof(uint32_t) * FLAG_WORDS(header->blockTotal + 1), false);
+    AddRegion(layout, level->enemyDead, sizeof(uint32_t) * FLAG_WORDS(header->enemyTotal + 1), false);
+    AddRegion(layout, level->coinCollected, sizeof(uint32_t) * FLAG_WORDS(header->coinTotal + 1), false);
+}
+
+void CaptureSnapshot(const SnapshotLayout* layout, uint8_t* out) {
+    const World* world = layout->world;
+    SnapshotState state = { 0 };
+    state.marioX = world->marioPosition.x;
+    state.marioY = world->marioPosition.y;
+    state.velocityY = world->velocityY;
+    state.marioDirection = world->marioDirection;
+    state.walkFrame = world->walkFrame;
+    state.walkFrameCounter = world->walkFrameCounter;
+    state.score = world->score;
+    state.tick = world->tick;
+    state.isJumping = world->isJumping;
+    state.isMoving = world->isMoving;
+    memcpy(out, &state, sizeof(state));
+
+    uint8_t* p = out + sizeof(state);
+    for (int r = 0; r < layout->regionCount; r++) {
+        const SnapshotRegion* region = &layout->regions[r];
+        size_t padded = AlignUp4(region->size);
+        memcpy(p, region->data, region->size);
+        // Dolgu sabit kalsın: farklar ve dosya içeriği tekrarlanabilir olur
+        memset(p + region->size, 0, padded - region->size);
+        p += padded;
+    }
+}
+
+void RestoreSnapshot(const SnapshotLayout* layout, const uint8_t* data) {
+    World* world = layout->world;
+    SnapshotState state;
+    memcpy(&state, data, sizeof(state));
+    world->marioPosition = (Vector2){ state.marioX, state.marioY };
+    world->velocityY = state.velocityY;
+    world->marioDirection = state.marioDirection;
+    world->walkFrame = state.walkFrame;
+    world->walkFrameCounter = state.walkFrameCounter;
+    world->score = state.score;
+    world->tick = state.tick;
+    world->isJumping = state.isJumping != 0;
+    world->isMoving = state.isMoving != 0;
+
+    bool redraw = false;
+    const uint8_t* p = data + sizeof(state);
+    for (int r = 0; r < layout->regionCount; r++) {
+        const SnapshotRegion* region = &layout->regions[r];
+        if (region->drawn && !redraw) redraw = memcmp(region->data, p, region->size) != 0;
+        memcpy(region->data, p, region->size);
+        p += AlignUp4(region->size);
+    }
+    // Hangi blokların değiştiği bilinmiyor; tüm parkur değişmiş sayılır
+    if (redraw && world->blocks.changed != NULL) world->blocks.changedCount = BLOCK_CHANGE_LOG + 1;
+    world->enemySchedule.stale = true;
+}
+
+uint32_t GetSnapshotTick(const uint8_t* data) {
+    SnapshotState state;
+    memcpy(&state, data, sizeof(state));
+    return state.tick;
+}
+
+// Fark kodlaması: XOR'lanmış kelimeler üzerinde (sıfır sayısı, değişen
+// sayısı, değişen kelimeler) grupları. Sayılar 7 bitlik varint; sondaki
+// sıfırlar yazılmaz, hiç değişiklik yoksa fark boştur.
+
+static void PutVarint(uint8_t** out, size_t value) {
+    uint8_t* p = *out;
+    while (value >= 0x80) {
+        *p++ = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    *p++ = (uint8_t)value;
+    *out = p;
+}
+
+static bool GetVarint(const uint8_t** in, const uint8_t* end, size_t* value) {
+    const uint8_t* p = *in;
+    size_t result = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (p == end) return false;
+        uint8_t byte = *p++;
+        result |= (size_t)(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            *in = p;
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint32_t XorWord(const uint8_t* base, const uint8_t* frame, size_t i) {
+    uint32_t a = 0, b;
+    if (base != NULL) memcpy(&a, base + i * 4, 4);
+    memcpy(&b, frame + i * 4, 4);
+    return a ^ b;
+}
+
+#define DELTA_BLOCK_WORDS 16
+static const uint8_t zeroBlock[DELTA_BLOCK_WORDS * 4];
+
+// Değişmeyen 64 baytlık bloklar kelime kelime bakılmadan atlanır
+static bool SameBlock(const uint8_t* base, const uint8_t* frame, size_t i) {
+    return memcmp(base != NULL ? base + i * 4 : zeroBlock, frame + i * 4, sizeof(zeroBlock)) == 0;
+}
+
+size_t GetSnapshotDeltaBound(size_t size) {
+    // Tek kelimelik değişen grupları en az bir sıfır kelime ayırır; grup
+    // başlıkları yalnızca çok uzun gruplarda kelimelerden büyük olabilir
+    return size + size / 64 + 16;
+}
+
+size_t EncodeSnapshotDelta(const uint8_t* base, const uint8_t* frame, size_t size, uint8_t* out) {
+    size_t words = size / 4;
+    uint8_t* p = out;
+    size_t i = 0;
+    while (i < words) {
+        size_t start = i;
+        for (;;) {
+            if (i + DELTA_BLOCK_WORDS <= words && SameBlock(base, frame, i)) i += DELTA_BLOCK_WORDS;
+            else if (i < words && XorWord(base, frame, i) == 0) i++;
+            else break;
+        }
+        size_t zeros = i - start;
+        start = i;
+        while (i < words && XorWord(base, frame, i) != 0) i++;
+        if (i == start) break; // Sondaki sıfırlar
+        PutVarint(&p, zeros);
+        PutVarint(&p, i - start);
+        for (size_t k = start; k < i; k++) {
+            uint32_t word = XorWord(base, frame, k);
+            memcpy(p, &word, 4);
+            p += 4;
+        }
+    }
+    return (size_t)(p - out);
+}
+
+bool ApplySnapshotDelta(uint8_t* base, size_t size, const uint8_t* delta, size_t deltaSize) {
+    size_t words = size / 4;
+    const uint8_t* p = delta;
+    const uint8_t* end = delta + deltaSize;
+    size_t i = 0;
+    while (p < end) {
+        size_t zeros, changed;
+        if (!GetVarint(&p, end, &zeros) || !GetVarint(&p, end, &changed)) return false;
+        if (zeros > words - i || changed > words - i - zeros || changed > (size_t)(end - p) / 4) return false;
+        i += zeros;
+        for (size_t k = 0; k < changed; k++, i++) {
+            uint32_t a, b;
+            memcpy(&a, base + i * 4, 4);
+            memcpy(&b, p, 4);
+            a ^= b;
+            memcpy(base + i * 4, &a, 4);
+            p += 4;
+        }
+    }
+    return true;
+}
+
+bool InitSnapshotRing(SnapshotRing* ring, const SnapshotLayout* layout, int frames, size_t dataBytes) {
+    memset(ring, 0, sizeof(*ring));
+    ring->layout = layout;
+    ring->capacity = frames > 1 ? frames - 1 : 1; // En yeni kare head'de tam durur
+    ring->dataCapacity = dataBytes;
+    ring->head = malloc(layout->size);
+    ring->frame = malloc(layout->size);
+    ring->encoded = malloc(GetSnapshotDeltaBound(layout->size));
+    ring->data = malloc(dataBytes > 0 ? dataBytes : 1);
+    ring->entries = malloc(sizeof(SnapshotEntry) * ring->capacity);
+    if (ring->head == NULL || ring->frame == NULL || ring->encoded == NULL || ring->data == NULL || ring->entries == NULL) {
+        FreeSnapshotRing(ring);
+        return false;
+    }
+    return true;
+}
+
+void FreeSnapshotRing(SnapshotRing* ring) {
+    free(ring->head);
+    free(ring->frame);
+    free(ring->encoded);
+    free(ring->data);
+    free(ring->entries);
+    memset(ring, 0, sizeof(*ring));
+}
+
+void ClearSnapshotRing(SnapshotRing* ring) {
+    ring->first = 0;
+    ring->count = 0;
+    ring->writeOffset = 0;
+    ring->hasHead = false;
+}
+
+static void DropOldest(SnapshotRing* ring) {
+    ring->first = (ring->first + 1) % ring->capacity;
+    ring->count--;
+}
+
+static void StoreDelta(SnapshotRing* ring, uint32_t tick, size_t size) {
+    if (size > ring->dataCapacity) {
+        // Fark tampona sığmıyor: daha eski kareler artık bu kareden geri çözülemez
+        ClearSnapshotRing(ring);
+        ring->hasHead = true;
+        return;
+    }
+    size_t offset = ring->writeOffset;
+    bool wrapped = offset + size > ring->dataCapacity;
+    if (wrapped) offset = 0;
+    // Farklar yazılış sırasıyla adres sırasında durur (en çok bir kez başa
+    // sarar) ve zincir yalnızca en eskiden kopabilir: yer açılana kadar en
+    // eski kare düşer. Başa sarınca önceki turun kuyruğu da düşer.
+    while (ring->count > 0) {
+        const SnapshotEntry* oldest = &ring->entries[ring->first];
+        bool stale = wrapped && oldest->offset >= ring->writeOffset;
+        bool overlaps = oldest->size > 0 && oldest->offset < offset + size && offset < oldest->offset + oldest->size;
+        if (ring->count < ring->capacity && !stale && !overlaps) break;
+        DropOldest(ring);
+    }
+
+    memcpy(ring->data + offset, ring->encoded, size);
+    SnapshotEntry* entry = &ring->entries[(ring->first + ring->count) % ring->capacity];
+    entry->tick = tick;
+    entry->offset = offset;
+    entry->size = size;
+    ring->count++;
+    ring->writeOffset = offset + size;
+}
+
+void PushSnapshot(SnapshotRing* ring) {
+    const SnapshotLayout* layout = ring->layout;
+    CaptureSnapshot(layout, ring->frame);
+    if (ring->hasHead) {
+        size_t size = EncodeSnapshotDelta(ring->frame, ring->head, layout->size, ring->encoded);
+        StoreDelta(ring, ring->headTick, size);
+    }
+    uint8_t* previous = ring->head;
+    ring->head = ring->frame;
+    ring->frame = previous;
+    ring->headTick = GetSnapshotTick(ring->head);
+    ring->hasHead = true;
+}
+
+int RewindSnapshots(SnapshotRing* ring, int frames) {
+    if (!ring->hasHead) return 0;
+    int rewound = 0;
+    while (rewound < frames && ring->count > 0) {
+        const SnapshotEntry* entry = &ring->entries[(ring->first + ring->count - 1) % ring->capacity];
+        ApplySnapshotDelta(ring->head, ring->layout->size, ring->data + entry->offset, entry->size);
+        ring->headTick = entry->tick;
+        ring->writeOffset = entry->offset;
+        ring->count--;
+        rewound++;
+    }
+    RestoreSnapshot(ring->layout, ring->head);
+    return rewound;
+}
+
+int GetSnapshotRingCount(const SnapshotRing* ring) {
+    return ring->hasHead ? ring->count + 1 : 0;
+}
+
+size_t GetSnapshotRingBytes(const SnapshotRing* ring) {
+    size_t bytes = 0;
+    for (int k = 0; k < ring->count; k++) bytes += ring->entries[(ring->first + k) % ring->capacity].size;
+    return bytes;
+}
+
+static uint32_t HashImage(const uint8_t* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool SaveSnapshot(const SnapshotLayout* layout, const char* path) {
+    uint8_t* image = malloc(layout->size);
+    uint8_t* delta = malloc(GetSnapshotDeltaBound(layout->size));
+    bool ok = false;
+    if (image != NULL && delta != NULL) {
+        CaptureSnapshot(layout, image);
+        SnapshotFileHeader header = { 0 };
+        memcpy(header.magic, SNAPSHOT_MAGIC, 4);
+        header.version = SNAPSHOT_VERSION;
+        header.size = (uint32_t)layout->size;
+        // Boş yuvalar ve grid'ler çoğunlukla sıfır; sıfıra göre fark sıkıştırır
+        header.deltaSize = (uint32_t)EncodeSnapshotDelta(NULL, image, layout->size, delta);
+        header.checksum = HashImage(image, layout->size);
+
+        FILE* file = fopen(path, "wb");
+        if (file != NULL) {
+            ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                (header.deltaSize == 0 || fwrite(delta, header.deltaSize, 1, file) == 1);
+            ok = fclose(file) == 0 && ok;
+        }
+    }
+    free(image);
+    free(delta);
+    return ok;
+}
+
+bool LoadSnapshot(const SnapshotLayout* layout, const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) return false;
+    SnapshotFileHeader header;
+    bool ok = fread(&header, sizeof(header), 1, file) == 1 && memcmp(header.magic, SNAPSHOT_MAGIC, 4) == 0 &&
+        header.version == SNAPSHOT_VERSION && header.size == layout->size &&
+        header.deltaSize <= GetSnapshotDeltaBound(layout->size);
+
+    uint8_t* image = NULL;
+    uint8_t* delta = NULL;
+    if (ok) {
+        image = calloc(layout->size, 1);
+        delta = malloc(header.deltaSize > 0 ? header.deltaSize : 1);
+        ok = image != NULL && delta != NULL &&
+            (header.deltaSize == 0 || fread(delta, header.deltaSize, 1, file) == 1) &&
+            ApplySnapshotDelta(image, layout->size, delta, header.deltaSize) &&
+            HashImage(image, layout->size) == header.checksum;
+    }
+    fclose(file);
+    // Dünya yalnızca görüntü eksiksiz ve tutarlıysa değişir
+    if (ok) RestoreSnapshot(layout, image);
+    free(image);
+    free(delta);
+    return ok;
+}
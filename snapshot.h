@@ -0,0 +1,121 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+// Dünya durumunun paketlenmiş, işaretçisiz anlık görüntüsü. Düzen dünya
+// kurulduktan sonra bir kez çıkarılır; yakalama ve geri yükleme bu düzene
+// göre yalnızca memcpy yapar, bellek ayırmaz.
+//
+// Görüntü: SnapshotState, ardından düzendeki bölgeler (her biri 4 bayta
+// hizalı). Gömülü parkurda yalnızca değişebilen diziler (düşman konumu,
+// bayraklar, düşman/coin grid'leri) kopyalanır; akışlı parkurda parçalar
+// yüklenip boşaltıldığı için tüm eleman dizileri, grid'ler ve Level'ın
+// parça durumu da görüntüye girer.
+//
+// Geri sarma halkası en yeni kareyi tam, öncekileri bir sonraki kareye
+// göre XOR farkı olarak tutar. Fark sıfır kelime dizileri atlanarak
+// kodlanır; tick başına değişen birkaç alan birkaç on bayta iner.
+//
+// Dosya düzeni (little-endian):
+//   SnapshotFileHeader
+//   sıfır görüntüye göre kodlanmış fark (size baytlık görüntü)
+
+#include "level.h"
+#include "world.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define SNAPSHOT_MAGIC "ASNP"
+#define SNAPSHOT_VERSION 3 // 2: kovalayan düşmanların y ve dikey hızı, 3: düşmanların uyanma tick'i
+#define SNAPSHOT_MAX_REGIONS 48
+
+typedef struct {
+    float marioX, marioY;
+    float velocityY;
+    int32_t marioDirection;
+    int32_t walkFrame;
+    int32_t walkFrameCounter;
+    int32_t score;
+    uint32_t tick;
+    uint8_t isJumping;
+    uint8_t isMoving;
+    uint8_t reserved[2];
+} SnapshotState;
+
+typedef struct {
+    void* data;
+    uint32_t size;
+    bool drawn; // Blok çizimini etkiler; geri yüklemede değişirse statik katman yenilenir
+} SnapshotRegion;
+
+typedef struct {
+    World* world;
+    Level* level; // Akışlı parkurda parça durumu için, değilse NULL
+    SnapshotRegion regions[SNAPSHOT_MAX_REGIONS];
+    int regionCount;
+    size_t size;  // Bir görüntünün bayt boyu (4'ün katı)
+} SnapshotLayout;
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t size;      // Görüntü boyu; düzen tutmazsa dosya yüklenmez
+    uint32_t deltaSize; // Başlıktan sonraki kodlanmış fark
+    uint32_t checksum;  // Çözülmüş görüntünün FNV-1a özeti
+} SnapshotFileHeader;
+
+typedef struct {
+    uint32_t tick;   // Farkın geri götürdüğü karenin tick'i
+    size_t offset;
+    size_t size;
+} SnapshotEntry;
+
+typedef struct {
+    const SnapshotLayout* layout;
+    uint8_t* head;     // En yeni kare, tam görüntü
+    uint8_t* frame;    // Yakalama tamponu
+    uint8_t* encoded;  // Kodlama tamponu (en kötü durum boyunda)
+    uint8_t* data;     // Farkların dairesel bayt tamponu
+    size_t dataCapacity;
+    size_t writeOffset;
+    SnapshotEntry* entries; // entries[(first + k) % capacity]: eskiden yeniye
+    int capacity;
+    int first;
+    int count;
+    bool hasHead;
+    uint32_t headTick;
+} SnapshotRing;
+
+// world (ve akışlı parkurda level) kurulduktan sonra çağrılır; dizi
+// işaretçileri değişirse düzen yeniden çıkarılmalıdır.
+void InitSnapshotLayout(SnapshotLayout* layout, World* world, Level* level);
+void CaptureSnapshot(const SnapshotLayout* layout, uint8_t* out);
+void RestoreSnapshot(const SnapshotLayout* layout, const uint8_t* data);
+uint32_t GetSnapshotTick(const uint8_t* data);
+
+// frame'in base'e göre XOR farkını out'a kodlar (base NULL ise sıfır
+// görüntü) ve kodlanmış boyu döner; out en az GetSnapshotDeltaBound baytlık
+// olmalıdır. ApplySnapshotDelta farkı base üzerine uygular; bozuk veride
+// false döner ve base yarım kalmış olabilir.
+size_t GetSnapshotDeltaBound(size_t size);
+size_t EncodeSnapshotDelta(const uint8_t* base, const uint8_t* frame, size_t size, uint8_t* out);
+bool ApplySnapshotDelta(uint8_t* base, size_t size, const uint8_t* delta, size_t deltaSize);
+
+// Halka en çok `frames` kare ve `dataBytes` baytlık fark tutar; ikisinden
+// biri dolunca en eski kare düşer. Tüm bellek burada ayrılır.
+bool InitSnapshotRing(SnapshotRing* ring, const SnapshotLayout* layout, int frames, size_t dataBytes);
+void FreeSnapshotRing(SnapshotRing* ring);
+void ClearSnapshotRing(SnapshotRing* ring);
+// Dünyanın şu anki durumunu en yeni kare yapar.
+void PushSnapshot(SnapshotRing* ring);
+// frames kare geri gidip dünyayı o kareye getirir ve geri gidilen kare
+// sayısını döner; halkada daha eski kare kalmadıysa en eskide durur.
+int RewindSnapshots(SnapshotRing* ring, int frames);
+// Halkanın tuttuğu (en yeni dahil) kare sayısı ve farkların toplam boyu.
+int GetSnapshotRingCount(const SnapshotRing* ring);
+size_t GetSnapshotRingBytes(const SnapshotRing* ring);
+
+// Dünyanın şu anki durumunu dosyaya yazar / dosyadan geri yükler.
+bool SaveSnapshot(const SnapshotLayout* layout, const char* path);
+bool LoadSnapshot(const SnapshotLayout* layout, const char* path);
+
+#endif
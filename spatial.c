@@ -0,0 +1,107 @@
+#include "spatial.h"
+#include <math.h>
+#include <stdlib.h>
+
+static int CellOf(float v) {
+    return (int)floorf(v / SPATIAL_CELL_SIZE);
+}
+
+static int BucketOf(const SpatialHash* hash, int cx, int cy) {
+    unsigned int h = ((unsigned int)cx * 73856093u) ^ ((unsigned int)cy * 19349663u);
+    return (int)(h & (unsigned int)hash->bucketMask);
+}
+
+bool InitSpatialHash(SpatialHash* hash, int capacity) {
+    int bucketCount = 16;
+    while (bucketCount < capacity * 2) bucketCount *= 2;
+
+    hash->heads = malloc(bucketCount * sizeof(int));
+    hash->next = malloc((capacity > 0 ? capacity : 1) * sizeof(int));
+    hash->cellX = malloc((capacity > 0 ? capacity : 1) * sizeof(int));
+    hash->cellY = malloc((capacity > 0 ? capacity : 1) * sizeof(int));
+    hash->inserted = calloc(capacity > 0 ? capacity : 1, sizeof(bool));
+    hash->bucketMask = bucketCount - 1;
+    hash->capacity = capacity;
+    if (hash->heads == NULL || hash->next == NULL || hash->cellX == NULL || hash->cellY == NULL || hash->inserted == NULL) {
+        FreeSpatialHash(hash);
+        return false;
+    }
+    ClearSpatialHash(hash);
+    return true;
+}
+
+void FreeSpatialHash(SpatialHash* hash) {
+    free(hash->heads);
+    free(hash->next);
+    free(hash->cellX);
+    free(hash->cellY);
+    free(hash->inserted);
+    hash->heads = hash->next = hash->cellX = hash->cellY = NULL;
+    hash->inserted = NULL;
+    hash->capacity = 0;
+}
+
+void ClearSpatialHash(SpatialHash* hash) {
+    for (int i = 0; i <= hash->bucketMask; i++) hash->heads[i] = -1;
+    for (int i = 0; i < hash->capacity; i++) hash->inserted[i] = false;
+}
+
+void SpatialHashInsert(SpatialHash* hash, int id, Rectangle rect) {
+    if (hash->inserted[id]) SpatialHashRemove(hash, id);
+    int cx = CellOf(rect.x);
+    int cy = CellOf(rect.y);
+    int bucket = BucketOf(hash, cx, cy);
+    hash->cellX[id] = cx;
+    hash->cellY[id] = cy;
+    hash->next[id] = hash->heads[bucket];
+    hash->heads[bucket] = id;
+    hash->inserted[id] = true;
+}
+
+void SpatialHashRemove(SpatialHash* hash, int id) {
+    if (!hash->inserted[id]) return;
+    int* link = &hash->heads[BucketOf(hash, hash->cellX[id], hash->cellY[id])];
+    while (*link != -1) {
+        if (*link == id) {
+            *link = hash->next[id];
+            break;
+        }
+        link = &hash->next[*link];
+    }
+    hash->inserted[id] = false;
+}
+
+void SpatialHashMove(SpatialHash* hash, int id, Rectangle rect) {
+    if (hash->inserted[id] && hash->cellX[id] == CellOf(rect.x) && hash->cellY[id] == CellOf(rect.y)) return;
+    SpatialHashInsert(hash, id, rect);
+}
+
+void BeginSpatialQuery(const SpatialHash* hash, Rectangle area, SpatialQuery* query) {
+    query->hash = hash;
+    query->cx0 = CellOf(area.x) - 1;
+    query->cx1 = CellOf(area.x + area.width);
+    query->cy1 = CellOf(area.y + area.height);
+    query->cx = query->cx0;
+    query->cy = CellOf(area.y) - 1;
+    query->item = hash->heads[BucketOf(hash, query->cx, query->cy)];
+}
+
+int NextSpatialQuery(SpatialQuery* query) {
+    const SpatialHash* hash = query->hash;
+    while (query->cy <= query->cy1) {
+        while (query->item != -1) {
+            int id = query->item;
+            query->item = hash->next[id];
+            // Aynı kovaya düşen başka hücrelerin elemanlarını ele
+            if (hash->cellX[id] == query->cx && hash->cellY[id] == query->cy) return id;
+        }
+        query->cx++;
+        if (query->cx > query->cx1) {
+            query->cx = query->cx0;
+            query->cy++;
+            if (query->cy > query->cy1) break;
+        }
+        query->item = hash->heads[BucketOf(hash, query->cx, query->cy)];
+    }
+    return -1;
+}
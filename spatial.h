@@ -0,0 +1,44 @@
+#ifndef SPATIAL_H
+#define SPATIAL_H
+
+// BLOCK_SIZE hücreli uniform grid üzerine kurulu spatial hash.
+// Her eleman sol üst köşesinin düştüğü tek bir hücrede tutulur; elemanlar
+// hücreden büyük olmadığı için sorgu alanı sol/üst yönde bir hücre
+// genişletilerek taşan elemanlar da bulunur.
+
+#include "raylib.h"
+#include <stdbool.h>
+
+#define SPATIAL_CELL_SIZE 64 // BLOCK_SIZE ile aynı
+
+typedef struct {
+    int* heads;     // Kova başına ilk eleman, boşsa -1
+    int bucketMask;
+    int* next;      // Eleman başına aynı kovadaki sonraki eleman
+    int* cellX;     // Elemanın bulunduğu hücre
+    int* cellY;
+    bool* inserted;
+    int capacity;
+} SpatialHash;
+
+typedef struct {
+    const SpatialHash* hash;
+    int cx0, cx1, cy1;
+    int cx, cy;
+    int item;
+} SpatialQuery;
+
+bool InitSpatialHash(SpatialHash* hash, int capacity);
+void FreeSpatialHash(SpatialHash* hash);
+void ClearSpatialHash(SpatialHash* hash);
+
+void SpatialHashInsert(SpatialHash* hash, int id, Rectangle rect);
+void SpatialHashRemove(SpatialHash* hash, int id);
+// Eleman hareket ettiğinde çağrılır; hücre değişmediyse hiçbir şey yapmaz.
+void SpatialHashMove(SpatialHash* hash, int id, Rectangle rect);
+
+// area ile kesişebilecek elemanları tek tek döndürür, bittiğinde -1.
+void BeginSpatialQuery(const SpatialHash* hash, Rectangle area, SpatialQuery* query);
+int NextSpatialQuery(SpatialQuery* query);
+
+#endif
@@ -0,0 +1,62 @@
+#include "spritebatch.h"
+#include "collide.h"
+#include "rlgl.h"
+#include <stddef.h>
+
+Rectangle GetCameraView(Camera2D camera, int screenWidth, int screenHeight) {
+    return (Rectangle){ camera.target.x - camera.offset.x / camera.zoom, camera.target.y - camera.offset.y / camera.zoom,
+        screenWidth / camera.zoom, screenHeight / camera.zoom };
+}
+
+void BeginSpriteBatch(SpriteBatch* batch, const SpriteAtlas* atlas, Rectangle view) {
+    batch->atlas = atlas;
+    batch->view = view;
+    batch->drawnCount = 0;
+    batch->culledCount = 0;
+}
+
+void DrawSprite(SpriteBatch* batch, SpriteId id, Vector2 position, bool flipX) {
+    DrawSpriteTinted(batch, id, position, flipX, WHITE);
+}
+
+void DrawSpriteTinted(SpriteBatch* batch, SpriteId id, Vector2 position, bool flipX, Color tint) {
+    const SpriteAtlas* atlas = batch->atlas;
+    Rectangle src = atlas->regions[id];
+    Rectangle dst = { position.x, position.y, src.width, src.height };
+    if (src.width == 0 || !CheckCollision(batch->view, dst)) {
+        batch->culledCount++;
+        return;
+    }
+
+    float u0 = src.x / atlas->texture.width;
+    float u1 = (src.x + src.width) / atlas->texture.width;
+    float v0 = src.y / atlas->texture.height;
+    float v1 = (src.y + src.height) / atlas->texture.height;
+    if (flipX) {
+        float t = u0;
+        u0 = u1;
+        u1 = t;
+    }
+
+    // Batch dolarsa rlgl önce mevcut dörtgenleri gönderir; doku yeniden seçilmeli
+    rlCheckRenderBatchLimit(4);
+    rlSetTexture(atlas->texture.id);
+    rlBegin(RL_QUADS);
+    rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+    rlTexCoord2f(u0, v0);
+    rlVertex2f(dst.x, dst.y);
+    rlTexCoord2f(u0, v1);
+    rlVertex2f(dst.x, dst.y + dst.height);
+    rlTexCoord2f(u1, v1);
+    rlVertex2f(dst.x + dst.width, dst.y + dst.height);
+    rlTexCoord2f(u1, v0);
+    rlVertex2f(dst.x + dst.width, dst.y);
+    rlEnd();
+    batch->drawnCount++;
+}
+
+void EndSpriteBatch(SpriteBatch* batch) {
+    rlSetTexture(0);
+    batch->atlas = NULL;
+}
@@ -0,0 +1,27 @@
+#ifndef SPRITEBATCH_H
+#define SPRITEBATCH_H
+
+// Atlas sprite'larını kamera görüş alanına göre eleyip rlgl'in aktif
+// batch'ine dörtgen olarak ekler. Aynı doku kullanıldığı sürece raylib
+// bunları tek draw call'da gönderir.
+
+#include "raylib.h"
+#include "atlas.h"
+
+typedef struct {
+    const SpriteAtlas* atlas;
+    Rectangle view;   // Dünya koordinatlarında görüş alanı
+    int drawnCount;
+    int culledCount;
+} SpriteBatch;
+
+// Camera2D'nin ekran boyutundaki dünya görüş alanı
+Rectangle GetCameraView(Camera2D camera, int screenWidth, int screenHeight);
+
+void BeginSpriteBatch(SpriteBatch* batch, const SpriteAtlas* atlas, Rectangle view);
+// flipX yatayda ayna çizer; sprite görüş alanı dışındaysa hiçbir şey eklenmez.
+void DrawSprite(SpriteBatch* batch, SpriteId id, Vector2 position, bool flipX);
+void DrawSpriteTinted(SpriteBatch* batch, SpriteId id, Vector2 position, bool flipX, Color tint);
+void EndSpriteBatch(SpriteBatch* batch);
+
+#endif
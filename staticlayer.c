@@ -0,0 +1,163 @@
+#include "staticlayer.h"
+#include "collide.h"
+#include "spritebatch.h"
+#include <math.h>
+#include <string.h>
+
+#define SPENT_BLOCK_TINT (Color){ 150, 150, 150, 255 } // Vurulmuş soru bloğu
+
+static Rectangle GetTileRect(int tileX, int tileY) {
+    return (Rectangle){ (float)tileX * STATIC_TILE_SIZE, (float)tileY * STATIC_TILE_SIZE, STATIC_TILE_SIZE, STATIC_TILE_SIZE };
+}
+
+static int ToTile(float v) {
+    return (int)floorf(v / STATIC_TILE_SIZE);
+}
+
+void InitStaticLayer(StaticLayer* layer, const SpriteAtlas* atlas, Color background) {
+    memset(layer, 0, sizeof(*layer));
+    layer->atlas = atlas;
+    layer->background = background;
+}
+
+void UnloadStaticLayer(StaticLayer* layer) {
+    for (int s = 0; s < STATIC_MAX_TILES; s++) {
+        if (layer->tiles[s].target.id != 0) UnloadRenderTexture(layer->tiles[s].target);
+    }
+    memset(layer->tiles, 0, sizeof(layer->tiles));
+}
+
+void SetStaticLayerClouds(StaticLayer* layer, const Vector2* clouds, int cloudCount) {
+    layer->clouds = clouds;
+    layer->cloudCount = cloudCount;
+    InvalidateStaticLayer(layer);
+}
+
+void InvalidateStaticLayer(StaticLayer* layer) {
+    for (int s = 0; s < STATIC_MAX_TILES; s++) layer->tiles[s].valid = false;
+}
+
+void InvalidateStaticRect(StaticLayer* layer, Rectangle rect) {
+    for (int s = 0; s < STATIC_MAX_TILES; s++) {
+        StaticTile* tile = &layer->tiles[s];
+        if (tile->used && CheckCollision(rect, GetTileRect(tile->tileX, tile->tileY))) tile->valid = false;
+    }
+}
+
+static void RenderTile(const StaticLayer* layer, const World* world, const StaticTile* tile) {
+    Rectangle area = GetTileRect(tile->tileX, tile->tileY);
+    Camera2D camera = { 0 };
+    camera.target = (Vector2){ area.x, area.y };
+    camera.zoom = 1.0f;
+
+    BeginTextureMode(tile->target);
+    ClearBackground(layer->background);
+    BeginMode2D(camera);
+
+    // Zemin karoya kırpılarak çizilir; uzun parkurlarda int taşmasın
+    float groundLeft = fmaxf(area.x, GROUND_START_X);
+    float groundRight = fminf(area.x + area.width, (float)GROUND_START_X + world->levelLength);
+    if (groundLeft < groundRight) {
+        DrawRectangleRec((Rectangle){ groundLeft, (float)world->groundY, groundRight - groundLeft, GROUND_HEIGHT }, GREEN);
+    }
+
+    SpriteBatch batch;
+    BeginSpriteBatch(&batch, layer->atlas, area);
+    // Bulutlar parkur boyunca x'e göre sıralı; karoya değen ilki ikili aramayla bulunur
+    float cloudWidth = layer->atlas->regions[SPRITE_CLOUD].width;
+    int first = 0, last = layer->cloudCount;
+    while (first < last) {
+        int mid = first + (last - first) / 2;
+        if (layer->clouds[mid].x + cloudWidth <= area.x) first = mid + 1;
+        else last = mid;
+    }
+    for (int i = first; i < layer->cloudCount && layer->clouds[i].x < area.x + area.width; i++) {
+        DrawSprite(&batch, SPRITE_CLOUD, layer->clouds[i], false);
+    }
+
+    // Sprite çarpışma kutusundan büyük olabilir; sol/üstteki bloklar da taşabilir
+    const BlockSet* blocks = &world->blocks;
+    Rectangle query = { area.x - BLOCK_SIZE, area.y - BLOCK_SIZE, area.width + BLOCK_SIZE, area.height + BLOCK_SIZE };
+    SpatialQuery it;
+    BeginSpatialQuery(&world->blockGrid, query, &it);
+    int i;
+    while ((i = NextSpatialQuery(&it)) != -1) {
+        if (blocks->width[i] == 0) continue;
+        bool spent = !GetFlag(blocks->stone, i) && GetFlag(blocks->hit, i);
+        DrawSpriteTinted(&batch, blocks->sprite[i], (Vector2){ blocks->x[i], blocks->y[i] }, false, spent ? SPENT_BLOCK_TINT : WHITE);
+    }
+    EndSpriteBatch(&batch);
+
+    EndMode2D();
+    EndTextureMode();
+}
+
+// Karo yuvadaysa onu, değilse boş ya da en uzun süre görülmemiş yuvayı döner
+static StaticTile* AcquireTile(StaticLayer* layer, int tileX, int tileY) {
+    StaticTile* victim = NULL;
+    for (int s = 0; s < STATIC_MAX_TILES; s++) {
+        StaticTile* tile = &layer->tiles[s];
+        if (!tile->used) {
+            if (victim == NULL || victim->used) victim = tile;
+            continue;
+        }
+        if (tile->tileX == tileX && tile->tileY == tileY) return tile;
+        // Bu karede görülen karolar atılmaz
+        if (tile->lastUsed == layer->frame) continue;
+        if (victim == NULL || (victim->used && tile->lastUsed < victim->lastUsed)) victim = tile;
+    }
+    if (victim == NULL) return NULL;
+    if (victim->target.id == 0) {
+        victim->target = LoadRenderTexture(STATIC_TILE_SIZE, STATIC_TILE_SIZE);
+        if (victim->target.id == 0) return NULL;
+    }
+    victim->used = true;
+    victim->valid = false;
+    victim->tileX = tileX;
+    victim->tileY = tileY;
+    return victim;
+}
+
+void UpdateStaticLayer(StaticLayer* layer, World* world, Rectangle view) {
+    BlockSet* blocks = &world->blocks;
+    if (blocks->changedCount > BLOCK_CHANGE_LOG) {
+        InvalidateStaticLayer(layer);
+    }
+    else {
+        for (int k = 0; k < blocks->changedCount; k++) {
+            Rectangle rect = blocks->changed[k];
+            // Sprite çarpışma kutusundan büyük olabilir
+            rect.width += BLOCK_SIZE;
+            rect.height += BLOCK_SIZE;
+            InvalidateStaticRect(layer, rect);
+        }
+    }
+    blocks->changedCount = 0;
+
+    layer->frame++;
+    layer->renderedCount = 0;
+    for (int ty = ToTile(view.y); ty <= ToTile(view.y + view.height); ty++) {
+        for (int tx = ToTile(view.x); tx <= ToTile(view.x + view.width); tx++) {
+            StaticTile* tile = AcquireTile(layer, tx, ty);
+            if (tile == NULL) continue;
+            tile->lastUsed = layer->frame;
+            if (!tile->valid) {
+                RenderTile(layer, world, tile);
+                tile->valid = true;
+                layer->renderedCount++;
+            }
+        }
+    }
+}
+
+void DrawStaticLayer(const StaticLayer* layer, Rectangle view) {
+    for (int s = 0; s < STATIC_MAX_TILES; s++) {
+        const StaticTile* tile = &layer->tiles[s];
+        if (!tile->used || !tile->valid) continue;
+        Rectangle area = GetTileRect(tile->tileX, tile->tileY);
+        if (!CheckCollision(view, area)) continue;
+        // RenderTexture OpenGL düzeninde ters durur
+        DrawTextureRec(tile->target.texture, (Rectangle){ 0, 0, STATIC_TILE_SIZE, -STATIC_TILE_SIZE },
+            (Vector2){ area.x, area.y }, WHITE);
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef STATICLAYER_H
+#define STATICLAYER_H
+
+// Parkurun neredeyse hiç değişmeyen kısmı (zemin, bulutlar, bloklar)
+// STATIC_TILE_SIZE'lık RenderTexture2D karolarına önceden çizilir. Her
+// kare yalnızca görüş alanına düşen karolar birleştirilir; böylece çizim
+// işi parkur boyuna değil ekran boyuna bağlıdır. Bir blok eklenince,
+// boşaltılınca veya vurulunca (BlockSet değişiklik kaydı) yalnızca o
+// alana değen karolar yeniden çizilir. Karolar ilk görüldüklerinde
+// çizilir ve en uzun süre kullanılmayan yuva yeniden kullanılır.
+
+#include "raylib.h"
+#include "atlas.h"
+#include "world.h"
+
+#define STATIC_TILE_SIZE 512
+#define STATIC_MAX_TILES 24 // 1200x800 görüş alanı en fazla 4x3 karoya değer
+
+typedef struct {
+    RenderTexture2D target;
+    int tileX, tileY;      // Karo koordinatı (dünya / STATIC_TILE_SIZE)
+    bool used;             // Yuvada bir karo var
+    bool valid;            // İçeriği güncel
+    unsigned int lastUsed; // LRU için son görüldüğü kare
+} StaticTile;
+
+typedef struct {
+    StaticTile tiles[STATIC_MAX_TILES];
+    const SpriteAtlas* atlas;
+    const Vector2* clouds;
+    int cloudCount;
+    Color background;
+    unsigned int frame;
+    int renderedCount; // Son güncellemede yeniden çizilen karo
+} StaticLayer;
+
+// GPU kaynağı ayırmaz; karolar ilk kullanımda yüklenir.
+void InitStaticLayer(StaticLayer* layer, const SpriteAtlas* atlas, Color background);
+void UnloadStaticLayer(StaticLayer* layer);
+
+// Bulut dizisi çağıranda kalır ve x'e göre artan sıradadır; tüm karolar geçersiz olur.
+void SetStaticLayerClouds(StaticLayer* layer, const Vector2* clouds, int cloudCount);
+void InvalidateStaticLayer(StaticLayer* layer);
+void InvalidateStaticRect(StaticLayer* layer, Rectangle rect);
+
+// Blok değişiklik kaydını tüketir ve görüş alanındaki eksik/geçersiz
+// karoları çizer. Karoya çizim framebuffer değiştirdiği için
+// BeginDrawing'den önce çağrılmalıdır.
+void UpdateStaticLayer(StaticLayer* layer, World* world, Rectangle view);
+// Görüş alanındaki karoları dünya koordinatında çizer (BeginMode2D içinde).
+void DrawStaticLayer(const StaticLayer* layer, Rectangle view);
+
+#endif
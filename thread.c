@@ -0,0 +1,223 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L // clock_gettime
+#endif
+#include "thread.h"
+#include <stdlib.h>
+
+typedef struct {
+    ThreadFunc func;
+    void* arg;
+} ThreadStart;
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <process.h>
+
+static unsigned __stdcall ThreadEntry(void* param) {
+    ThreadStart start = *(ThreadStart*)param;
+    free(param);
+    return (unsigned)start.func(start.arg);
+}
+
+bool StartThread(Thread* thread, ThreadFunc func, void* arg) {
+    ThreadStart* start = malloc(sizeof(ThreadStart));
+    if (start == NULL) return false;
+    start->func = func;
+    start->arg = arg;
+    uintptr_t handle = _beginthreadex(NULL, 0, ThreadEntry, start, 0, NULL);
+    if (handle == 0) {
+        free(start);
+        return false;
+    }
+    thread->handle = (void*)handle;
+    return true;
+}
+
+void JoinThread(Thread* thread) {
+    WaitForSingleObject((HANDLE)thread->handle, INFINITE);
+    CloseHandle((HANDLE)thread->handle);
+    thread->handle = NULL;
+}
+
+void YieldThread(void) {
+    SwitchToThread();
+}
+
+void SleepMilliseconds(int ms) {
+    Sleep((DWORD)ms);
+}
+
+bool InitMutex(Mutex* mutex) {
+    SRWLOCK* lock = malloc(sizeof(SRWLOCK));
+    if (lock == NULL) return false;
+    InitializeSRWLock(lock);
+    mutex->impl = lock;
+    return true;
+}
+
+void DestroyMutex(Mutex* mutex) {
+    free(mutex->impl);
+    mutex->impl = NULL;
+}
+
+void LockMutex(Mutex* mutex) {
+    AcquireSRWLockExclusive((SRWLOCK*)mutex->impl);
+}
+
+void UnlockMutex(Mutex* mutex) {
+    ReleaseSRWLockExclusive((SRWLOCK*)mutex->impl);
+}
+
+bool InitCondition(Condition* condition) {
+    CONDITION_VARIABLE* cv = malloc(sizeof(CONDITION_VARIABLE));
+    if (cv == NULL) return false;
+    InitializeConditionVariable(cv);
+    condition->impl = cv;
+    return true;
+}
+
+void DestroyCondition(Condition* condition) {
+    free(condition->impl);
+    condition->impl = NULL;
+}
+
+void WaitCondition(Condition* condition, Mutex* mutex) {
+    SleepConditionVariableSRW((CONDITION_VARIABLE*)condition->impl, (SRWLOCK*)mutex->impl, INFINITE, 0);
+}
+
+void SignalCondition(Condition* condition) {
+    WakeConditionVariable((CONDITION_VARIABLE*)condition->impl);
+}
+
+void BroadcastCondition(Condition* condition) {
+    WakeAllConditionVariable((CONDITION_VARIABLE*)condition->impl);
+}
+
+int GetCpuCount(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+}
+
+uint64_t GetMonotonicNs(void) {
+    static LARGE_INTEGER frequency;
+    if (frequency.QuadPart == 0) QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    // Taşmayı önlemek için saniye ve kalan ayrı çevrilir
+    uint64_t seconds = (uint64_t)counter.QuadPart / (uint64_t)frequency.QuadPart;
+    uint64_t rest = (uint64_t)counter.QuadPart % (uint64_t)frequency.QuadPart;
+    return seconds * 1000000000ull + rest * 1000000000ull / (uint64_t)frequency.QuadPart;
+}
+
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+static void* ThreadEntry(void* param) {
+    ThreadStart start = *(ThreadStart*)param;
+    free(param);
+    start.func(start.arg);
+    return NULL;
+}
+
+bool StartThread(Thread* thread, ThreadFunc func, void* arg) {
+    ThreadStart* start = malloc(sizeof(ThreadStart));
+    pthread_t* handle = malloc(sizeof(pthread_t));
+    if (start == NULL || handle == NULL) {
+        free(start);
+        free(handle);
+        return false;
+    }
+    start->func = func;
+    start->arg = arg;
+    if (pthread_create(handle, NULL, ThreadEntry, start) != 0) {
+        free(start);
+        free(handle);
+        return false;
+    }
+    thread->handle = handle;
+    return true;
+}
+
+void JoinThread(Thread* thread) {
+    pthread_join(*(pthread_t*)thread->handle, NULL);
+    free(thread->handle);
+    thread->handle = NULL;
+}
+
+void YieldThread(void) {
+    sched_yield();
+}
+
+void SleepMilliseconds(int ms) {
+    struct timespec duration = { ms / 1000, (long)(ms % 1000) * 1000000L };
+    while (nanosleep(&duration, &duration) != 0) {}
+}
+
+bool InitMutex(Mutex* mutex) {
+    pthread_mutex_t* lock = malloc(sizeof(pthread_mutex_t));
+    if (lock == NULL || pthread_mutex_init(lock, NULL) != 0) {
+        free(lock);
+        return false;
+    }
+    mutex->impl = lock;
+    return true;
+}
+
+void DestroyMutex(Mutex* mutex) {
+    pthread_mutex_destroy((pthread_mutex_t*)mutex->impl);
+    free(mutex->impl);
+    mutex->impl = NULL;
+}
+
+void LockMutex(Mutex* mutex) {
+    pthread_mutex_lock((pthread_mutex_t*)mutex->impl);
+}
+
+void UnlockMutex(Mutex* mutex) {
+    pthread_mutex_unlock((pthread_mutex_t*)mutex->impl);
+}
+
+bool InitCondition(Condition* condition) {
+    pthread_cond_t* cv = malloc(sizeof(pthread_cond_t));
+    if (cv == NULL || pthread_cond_init(cv, NULL) != 0) {
+        free(cv);
+        return false;
+    }
+    condition->impl = cv;
+    return true;
+}
+
+void DestroyCondition(Condition* condition) {
+    pthread_cond_destroy((pthread_cond_t*)condition->impl);
+    free(condition->impl);
+    condition->impl = NULL;
+}
+
+void WaitCondition(Condition* condition, Mutex* mutex) {
+    pthread_cond_wait((pthread_cond_t*)condition->impl, (pthread_mutex_t*)mutex->impl);
+}
+
+void SignalCondition(Condition* condition) {
+    pthread_cond_signal((pthread_cond_t*)condition->impl);
+}
+
+void BroadcastCondition(Condition* condition) {
+    pthread_cond_broadcast((pthread_cond_t*)condition->impl);
+}
+
+int GetCpuCount(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
+
+uint64_t GetMonotonicNs(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+#endif
@@ -0,0 +1,89 @@
+#ifndef THREAD_H
+#define THREAD_H
+
+// İnce iş parçacığı katmanı: Windows'ta Win32, diğer sistemlerde pthreads.
+// windows.h raylib.h ile çakıştığı için platform tipleri burada
+// görünmez; kilit ve koşul değişkenleri heap'te tutulur.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef int (*ThreadFunc)(void* arg);
+
+typedef struct {
+    void* handle;
+} Thread;
+
+typedef struct {
+    void* impl;
+} Mutex;
+
+typedef struct {
+    void* impl;
+} Condition;
+
+bool StartThread(Thread* thread, ThreadFunc func, void* arg);
+void JoinThread(Thread* thread);
+// Zaman dilimini başka bir iş parçacığına bırakır
+void YieldThread(void);
+void SleepMilliseconds(int ms);
+
+bool InitMutex(Mutex* mutex);
+void DestroyMutex(Mutex* mutex);
+void LockMutex(Mutex* mutex);
+void UnlockMutex(Mutex* mutex);
+
+bool InitCondition(Condition* condition);
+void DestroyCondition(Condition* condition);
+// Çağıran mutex'i kilitlemiş olmalı; uyanınca kilit yeniden alınmış olur.
+void WaitCondition(Condition* condition, Mutex* mutex);
+void SignalCondition(Condition* condition);
+void BroadcastCondition(Condition* condition);
+
+int GetCpuCount(void);
+// Atomik 32 bit işlemler: yükleme acquire, yazma release, diğerleri tam
+// bariyer. MSVC'de C11 atomikleri olmadığı için intrinsic'ler kullanılır.
+#if defined(_MSC_VER)
+#include <intrin.h>
+
+static inline int AtomicLoad(volatile int* p) {
+    int v = *p;
+    _ReadWriteBarrier();
+    return v;
+}
+
+static inline void AtomicStore(volatile int* p, int v) {
+    _ReadWriteBarrier();
+    *p = v;
+}
+
+// Eklemeden sonraki değeri döner
+static inline int AtomicAdd(volatile int* p, int v) {
+    return _InterlockedExchangeAdd((volatile long*)p, v) + v;
+}
+
+static inline bool AtomicCompareExchange(volatile int* p, int expected, int desired) {
+    return _InterlockedCompareExchange((volatile long*)p, desired, expected) == expected;
+}
+#else
+static inline int AtomicLoad(volatile int* p) {
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+static inline void AtomicStore(volatile int* p, int v) {
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+
+static inline int AtomicAdd(volatile int* p, int v) {
+    return __atomic_add_fetch(p, v, __ATOMIC_SEQ_CST);
+}
+
+static inline bool AtomicCompareExchange(volatile int* p, int expected, int desired) {
+    return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+#endif
+
+// Monoton saat, nanosaniye; yalnızca farkları anlamlıdır.
+uint64_t GetMonotonicNs(void);
+
+#endif
@@ -0,0 +1,75 @@
+#include "wakewheel.h"
+#include <stdlib.h>
+
+bool InitWakeWheel(WakeWheel* wheel, int capacity) {
+    int n = capacity > 0 ? capacity : 1;
+    wheel->heads = malloc(WAKE_WHEEL_SLOTS * sizeof(int));
+    wheel->next = malloc(n * sizeof(int));
+    wheel->prev = malloc(n * sizeof(int));
+    wheel->tick = calloc(n, sizeof(uint32_t));
+    wheel->scheduled = calloc(n, sizeof(bool));
+    wheel->capacity = capacity;
+    if (wheel->heads == NULL || wheel->next == NULL || wheel->prev == NULL || wheel->tick == NULL || wheel->scheduled == NULL) {
+        FreeWakeWheel(wheel);
+        return false;
+    }
+    ClearWakeWheel(wheel, 0);
+    return true;
+}
+
+void FreeWakeWheel(WakeWheel* wheel) {
+    free(wheel->heads);
+    free(wheel->next);
+    free(wheel->prev);
+    free(wheel->tick);
+    free(wheel->scheduled);
+    wheel->heads = wheel->next = wheel->prev = NULL;
+    wheel->tick = NULL;
+    wheel->scheduled = NULL;
+    wheel->capacity = 0;
+}
+
+void ClearWakeWheel(WakeWheel* wheel, uint32_t now) {
+    for (int s = 0; s < WAKE_WHEEL_SLOTS; s++) wheel->heads[s] = -1;
+    for (int i = 0; i < wheel->capacity; i++) wheel->scheduled[i] = false;
+    wheel->now = now;
+}
+
+static void Unlink(WakeWheel* wheel, int id) {
+    int next = wheel->next[id], prev = wheel->prev[id];
+    if (prev != -1) wheel->next[prev] = next;
+    else wheel->heads[wheel->tick[id] & (WAKE_WHEEL_SLOTS - 1)] = next;
+    if (next != -1) wheel->prev[next] = prev;
+    wheel->scheduled[id] = false;
+}
+
+void ScheduleWake(WakeWheel* wheel, int id, uint32_t tick) {
+    if (wheel->scheduled[id]) Unlink(wheel, id);
+    int* head = &wheel->heads[tick & (WAKE_WHEEL_SLOTS - 1)];
+    wheel->tick[id] = tick;
+    wheel->prev[id] = -1;
+    wheel->next[id] = *head;
+    if (*head != -1) wheel->prev[*head] = id;
+    *head = id;
+    wheel->scheduled[id] = true;
+}
+
+void CancelWake(WakeWheel* wheel, int id) {
+    if (wheel->scheduled[id]) Unlink(wheel, id);
+}
+
+int TakeWakes(WakeWheel* wheel, int* out) {
+    uint32_t now = ++wheel->now;
+    int count = 0;
+    int id = wheel->heads[now & (WAKE_WHEEL_SLOTS - 1)];
+    while (id != -1) {
+        int next = wheel->next[id];
+        // Sonraki turlara ait olanlar yerinde kalır
+        if (wheel->tick[id] == now) {
+            Unlink(wheel, id);
+            out[count++] = id;
+        }
+        id = next;
+    }
+    return count;
+}
@@ -0,0 +1,37 @@
+#ifndef WAKEWHEEL_H
+#define WAKEWHEEL_H
+
+// Tick'e göre uyandırma çarkı. Her eleman uyanacağı tick'in
+// WAKE_WHEEL_SLOTS'a göre kalanındaki yuvada, çift bağlı listede tutulur;
+// yerleştirme, çıkarma ve bir tick'in elemanlarını alma toplam eleman
+// sayısından bağımsızdır. Çarkın bir turundan uzaktaki elemanlar kendi
+// yuvalarında kalır ve her turda bir kez atlanır.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define WAKE_WHEEL_SLOTS 1024 // 2'nin kuvveti
+
+typedef struct {
+    int* heads;      // Yuva başına ilk eleman, boşsa -1
+    int* next;       // Eleman başına aynı yuvadaki sonraki/önceki, yoksa -1
+    int* prev;
+    uint32_t* tick;  // Elemanın uyanacağı tick
+    bool* scheduled;
+    uint32_t now;    // Son alınan tick
+    int capacity;
+} WakeWheel;
+
+bool InitWakeWheel(WakeWheel* wheel, int capacity);
+void FreeWakeWheel(WakeWheel* wheel);
+// Tüm elemanları çıkarır; sıradaki TakeWakes now + 1'i alır.
+void ClearWakeWheel(WakeWheel* wheel, uint32_t now);
+
+// Eleman yerleştirilmişse önce eski yerinden çıkarılır; tick now'dan büyük olmalı.
+void ScheduleWake(WakeWheel* wheel, int id, uint32_t tick);
+void CancelWake(WakeWheel* wheel, int id);
+// now'u bir ilerletir; o tick'te uyananları çarktan çıkarıp out'a yazar
+// (en çok capacity) ve sayısını döner. Sıra yerleştirme geçmişine bağlıdır.
+int TakeWakes(WakeWheel* wheel, int* out);
+
+#endif
@@ -0,0 +1,932 @@
+#include "world.h"
+#include "navgrid.h"
+#include "profiler.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+void OturtMarioZemine(Vector2* marioPos, int groundY, int baseHeight) {
+    marioPos->y = groundY - baseHeight;
+}
+
+// Spatial sorgudan gelen adayları COLLIDE_BATCH'lik gruplar halinde toplar
+typedef struct {
+    int count;
+    int ids[COLLIDE_BATCH];
+    float x[COLLIDE_BATCH];
+    float y[COLLIDE_BATCH];
+    float width[COLLIDE_BATCH];
+    float height[COLLIDE_BATCH];
+} CandidateBatch;
+
+static int GatherCandidates(SpatialQuery* query, const float* x, const float* y, const float* width, const float* height,
+    CandidateBatch* batch) {
+    batch->count = 0;
+    while (batch->count < COLLIDE_BATCH) {
+        int id = NextSpatialQuery(query);
+        if (id == -1) break;
+        int k = batch->count++;
+        batch->ids[k] = id;
+        batch->x[k] = x[id];
+        batch->y[k] = y[id];
+        batch->width[k] = width[id];
+        batch->height[k] = height[id];
+    }
+    return batch->count;
+}
+
+// Mini level: platform zemine yakın, düşmanlar zeminde
+void InitLevel(BlockSet* blocks, EnemySet* enemies, CoinSet* coins, int groundY) {
+    // Platform parametreleri
+    int platY = groundY - BLOCK_SIZE - 40; // Zemine daha yakın (40px yukarıda)
+    int platStartX = GROUND_START_X + 250;
+    int platBlockCount = 8; // Platformda toplam blok sayısı (tasblok + sorublok)
+
+    // Platform: [tasblok][sorublok][tasblok][sorublok]...[tasblok]
+    for (int i = 0; i < platBlockCount; i++) {
+        BlockType type = (i % 2 == 0) ? BLOCK_STONE : BLOCK_QUESTION;
+        AddBlock(blocks, (Rectangle){ platStartX + i * BLOCK_SIZE, platY, BLOCK_SIZE, BLOCK_SIZE }, type, type == BLOCK_QUESTION);
+
+        // Coin, soru bloğun üstünde
+        if (type == BLOCK_QUESTION) {
+            AddCoin(coins, (Rectangle){ platStartX + i * BLOCK_SIZE + (BLOCK_SIZE - COIN_SIZE) / 2, platY - COIN_SIZE, COIN_SIZE, COIN_SIZE });
+        }
+    }
+
+    // Düşmanlar: zeminde, platformun sol ve sağ taraflarında
+    int enemyY = groundY - ENEMY_SIZE - 100; // Zemin yüksekliği 100, düşman tam üstünde
+    int enemyX1 = platStartX - 120;
+    int enemyX2 = platStartX + platBlockCount * BLOCK_SIZE + 40;
+    AddEnemy(enemies, (Rectangle){ enemyX1, enemyY, ENEMY_SIZE, ENEMY_SIZE }, 1, 2.0f);
+    AddEnemy(enemies, (Rectangle){ enemyX2, enemyY, ENEMY_SIZE, ENEMY_SIZE }, -1, 2.0f);
+}
+
+// Düşmanın bir tick'lik adımı: tasbloklara çarpınca yön değiştirir,
+// zeminde hareket eder
+static void StepEnemy(EnemySet* enemies, int i, const BlockSet* blocks, const SpatialHash* blockGrid, int levelLength) {
+    float step = enemies->direction[i] * enemies->speed[i];
+    enemies->x[i] += step;
+
+    // Tasbloklara çarpınca yön değiştir (yalnızca yakın hücreler)
+    Rectangle enemyNext = GetEnemyRect(enemies, i);
+    enemyNext.x += step;
+    SpatialQuery query;
+    CandidateBatch batch;
+    bool turned = false;
+    BeginSpatialQuery(blockGrid, enemyNext, &query);
+    while (!turned && GatherCandidates(&query, blocks->x, blocks->y, blocks->width, blocks->height, &batch) > 0) {
+        uint32_t mask;
+        if (CheckCollisionBatch(enemyNext, batch.x, batch.y, batch.width, batch.height, batch.count, &mask) == 0) continue;
+        for (int k = 0; k < batch.count; k++) {
+            if (((mask >> k) & 1u) && GetFlag(blocks->stone, batch.ids[k])) {
+                enemies->direction[i] = -enemies->direction[i];
+                turned = true;
+                break;
+            }
+        }
+    }
+    // Harita sınırından çıkmasın
+    if (enemies->x[i] < GROUND_START_X) {
+        enemies->x[i] = GROUND_START_X;
+        enemies->direction[i] = 1;
+    }
+    if (enemies->x[i] > GROUND_START_X + levelLength - ENEMY_SIZE) {
+        enemies->x[i] = GROUND_START_X + levelLength - ENEMY_SIZE;
+        enemies->direction[i] = -1;
+    }
+}
+
+// x'ten dir yönünde yürüyen düşmanın kaç tick sonra döneceği. StepEnemy
+// önce adım atar, sonra bir adım ilerisi bir tasbloğa değiyorsa döner;
+// düşman x + n * speed noktalarında kaldığı için her duvar için dönüş
+// tick'i kapalı biçimde bulunur. Parkur kenarında kırpılarak dönerse
+// *atEdge true olur. maxTicks içinde dönmüyorsa maxTicks'ten büyük döner.
+static double TicksToTurn(const EnemySet* enemies, int i, double x, int dir, double maxTicks, const BlockSet* blocks,
+    const SpatialHash* blockGrid, int levelLength, bool* atEdge) {
+    double speed = enemies->speed[i];
+    double width = enemies->width[i];
+    float top = enemies->y[i], bottom = enemies->y[i] + enemies->height[i];
+    double levelLeft = GROUND_START_X;
+    double levelRight = (double)GROUND_START_X + levelLength - ENEMY_SIZE;
+    double best = dir > 0 ? floor((levelRight - x) / speed) + 1.0 : floor((x - levelLeft) / speed) + 1.0;
+    *atEdge = true;
+
+    // Duvarlar gidilebilecek mesafeden uzaktaysa etkisizdir; pencere ona göre büyür
+    double reach = (maxTicks + 2.0) * speed + width;
+    for (double window = 8.0 * BLOCK_SIZE;; window *= 4.0) {
+        Rectangle area = { (float)(dir > 0 ? x : x - window), top, (float)(window + width), bottom - top };
+        SpatialQuery query;
+        BeginSpatialQuery(blockGrid, area, &query);
+        int j;
+        while ((j = NextSpatialQuery(&query)) != -1) {
+            if (!GetFlag(blocks->stone, j) || blocks->y[j] >= bottom || blocks->y[j] + blocks->height[j] <= top) continue;
+            double left = blocks->x[j], right = blocks->x[j] + blocks->width[j];
+            // m. adımdaki bakış noktası p = x + dir * m * speed; (left - width, right) içindeyse değer
+            double m;
+            if (dir > 0) {
+                m = fmax(2.0, floor((left - width - x) / speed) + 1.0);
+                if (x + m * speed >= right) continue;
+            }
+            else {
+                m = fmax(2.0, floor((x - right) / speed) + 1.0);
+                if (x - m * speed + width <= left) continue;
+            }
+            if (m - 1.0 < best) {
+                best = m - 1.0;
+                *atEdge = false;
+            }
+        }
+        if ((best + 1.0) * speed + width <= window || window >= reach) break;
+    }
+    return best;
+}
+
+// Düşmanı `ticks` tick ilerletir: dönüşten dönüşe koşular halinde gider,
+// dönüş noktaları tekrar edince kalan tam turlar atlanır. Böylece uzun
+// uyku sonrası bile konum, her tick güncellenmiş olsaydı bulunacak yerdir.
+static void AdvanceEnemyPatrol(EnemySet* enemies, int i, uint32_t ticks, const BlockSet* blocks, const SpatialHash* blockGrid,
+    int levelLength) {
+    if (ticks == 0) return;
+    double levelLeft = GROUND_START_X;
+    double levelRight = (double)GROUND_START_X + levelLength - ENEMY_SIZE;
+    // Düşman sığmıyorsa StepEnemy her tick onu sağ kırpmaya sola dönük bırakır
+    if (levelRight < levelLeft) {
+        enemies->x[i] = (float)levelRight;
+        enemies->direction[i] = -1;
+        return;
+    }
+    // Hızı pozitif olmayan düşmanın (yükleyiciler reddeder) kapalı biçimi yok;
+    // parkur dışında başlayan ise ilk adımda kırpılır. İkisi de tick tick yürür.
+    if (enemies->speed[i] <= 0.0f) {
+        for (uint32_t t = 0; t < ticks; t++) StepEnemy(enemies, i, blocks, blockGrid, levelLength);
+        return;
+    }
+    if (enemies->x[i] < levelLeft || enemies->x[i] > levelRight) {
+        StepEnemy(enemies, i, blocks, blockGrid, levelLength);
+        if (--ticks == 0) return;
+    }
+
+    double speed = enemies->speed[i];
+    double x = enemies->x[i];
+    int dir = enemies->direction[i];
+    double remaining = ticks;
+    // Son iki dönüşün durumu: iki koşu önceki dönüşle aynıysa yörünge periyodik
+    double turnX[2] = { NAN, NAN };
+    double turnRemaining[2] = { 0.0, 0.0 };
+    int turns = 0;
+    while (remaining > 0.0) {
+        bool atEdge;
+        // Parkur içinden her koşu en az bir tick sürer; döngü hep ilerler
+        double run = fmax(1.0, TicksToTurn(enemies, i, x, dir, remaining, blocks, blockGrid, levelLength, &atEdge));
+        if (run > remaining) {
+            x += dir * remaining * speed;
+            break;
+        }
+        if (atEdge) x = dir > 0 ? levelRight : levelLeft;
+        else x += dir * run * speed;
+        dir = -dir;
+        remaining -= run;
+
+        int slot = turns & 1;
+        if (turns >= 2 && fabs(turnX[slot] - x) < 1e-3) {
+            double period = turnRemaining[slot] - remaining;
+            if (period > 0.0) remaining = fmod(remaining, period);
+        }
+        turnX[slot] = x;
+        turnRemaining[slot] = remaining;
+        turns++;
+    }
+    enemies->x[i] = (float)x;
+    enemies->direction[i] = (int8_t)dir;
+}
+
+// Kovalayan düşmanın dikey adımının sonucu: yerçekimiyle düşerken en
+// yakın blok üstüne oturur, yükselirken bloğa alttan çarpar
+typedef struct {
+    float y;
+    bool landed;
+    bool bumped;
+} EnemyFall;
+
+// Yol süpürülür; hızlı düşüşte blok atlanmaz. Oturulan/çarpılan blok
+// y'yi güncellediği için adaylar hangi sırayla gelirse gelsin en yakını kazanır.
+static void ClipEnemyFall(EnemyFall* fall, float x, float width, float height, float y0, float vy, Rectangle block) {
+    if (block.x >= x + width || block.x + block.width <= x) return;
+    if (vy > 0 && block.y >= y0 + height - NAV_FLOOR_EPSILON && block.y < fall->y + height) {
+        fall->y = block.y - height;
+        fall->landed = true;
+    }
+    else if (vy < 0 && block.y + block.height <= y0 + NAV_FLOOR_EPSILON && block.y + block.height > fall->y) {
+        fall->y = block.y + block.height;
+        fall->bumped = true;
+    }
+}
+
+// Kovalayan düşman: yönü akış alanından alır, tüm bloklara çarpar ve
+// yerçekimiyle düşer. Yerdeyken akış zıpla derse ya da yolu bir blok
+// keserse zıplar; hedefe yolu yoksa devriyedeki gibi engelde döner.
+static void StepChasingEnemy(EnemySet* enemies, int i, const BlockSet* blocks, const SpatialHash* blockGrid, int levelLength,
+    const NavGrid* nav, float targetX) {
+    float width = enemies->width[i], height = enemies->height[i];
+    float x0 = enemies->x[i], y0 = enemies->y[i];
+    float centerX = x0 + width / 2;
+    NavMove move = GetNavMove(nav, centerX, y0 + height);
+    int dir = enemies->direction[i];
+    float step = enemies->speed[i];
+    if (move == NAV_MOVE_LEFT || move == NAV_MOVE_JUMP_LEFT) dir = -1;
+    else if (move == NAV_MOVE_RIGHT || move == NAV_MOVE_JUMP_RIGHT) dir = 1;
+    else if (move == NAV_MOVE_ARRIVED) {
+        // Aynı zeminde: doğrudan Mario'ya yürür, hizasına gelince durur
+        dir = targetX < centerX ? -1 : 1;
+        step = fminf(step, fabsf(targetX - centerX));
+    }
+
+    float levelRight = (float)(GROUND_START_X + levelLength - ENEMY_SIZE);
+    float x1 = x0 + dir * step;
+    bool blocked = x1 < GROUND_START_X || x1 > levelRight;
+    x1 = fminf(fmaxf(x1, GROUND_START_X), levelRight);
+    Rectangle next = { x1, y0, width, height };
+
+    // Tek sorgu: yatay adım ve iki olası x için dikey adım birlikte; hangisi
+    // geçerli olacağı yatay adım bloğa girip girmemesine bağlı
+    float vy = enemies->velocityY[i] + GRAVITY;
+    EnemyFall stay = { y0 + vy, false, false }, moved = stay;
+    Rectangle area = { fminf(x0, x1), fminf(y0, y0 + vy), width + fabsf(x1 - x0), height + fabsf(vy) };
+    SpatialQuery query;
+    BeginSpatialQuery(blockGrid, area, &query);
+    int j;
+    while ((j = NextSpatialQuery(&query)) != -1) {
+        if (blocks->width[j] == 0) continue;
+        Rectangle block = GetBlockRect(blocks, j);
+        if (CheckCollision(next, block)) blocked = true;
+        ClipEnemyFall(&stay, x0, width, height, y0, vy, block);
+        ClipEnemyFall(&moved, x1, width, height, y0, vy, block);
+    }
+    EnemyFall fall = blocked ? stay : moved;
+    if (fall.y + height >= nav->groundY) {
+        fall.y = nav->groundY - height;
+        fall.landed = true;
+    }
+    enemies->x[i] = blocked ? x0 : x1;
+    enemies->y[i] = fall.y;
+    enemies->velocityY[i] = (fall.landed || fall.bumped) ? 0.0f : vy;
+
+    bool wantsJump = move == NAV_MOVE_JUMP_LEFT || move == NAV_MOVE_JUMP_RIGHT ||
+        (blocked && (move == NAV_MOVE_LEFT || move == NAV_MOVE_RIGHT));
+    if (fall.landed && wantsJump) enemies->velocityY[i] = -ENEMY_JUMP_FORCE;
+    else if (blocked && move == NAV_MOVE_NONE) dir = -dir;
+    enemies->direction[i] = (int8_t)dir;
+}
+
+// Düşman ile odak her tick birbirine en çok speed + MARIO_SPEED yaklaşır.
+// j tick sonraki sınıflandırmada uzaklık en az
+// distance - speed * (j - 1) - MARIO_SPEED * j olduğundan yakın banda
+// giremeyeceği tick'ler atlanır; orta banttaki en geç
+// ENEMY_LOD_MID_INTERVAL tick sonra yetiştirilir.
+static uint32_t NextEnemyWake(const EnemySet* enemies, int i, const EnemyLod* lod) {
+    float distance = fabsf(enemies->x[i] + enemies->width[i] / 2 - lod->focusX);
+    if (!(distance > lod->nearDistance)) return lod->tick + 1;
+    // 1px pay: sınıflandırma float, bu hesap double. Negatif hız ters yönde
+    // yürütür; yaklaşma hızı için büyüklüğü alınır.
+    double speed = fabs((double)enemies->speed[i]);
+    double closing = speed + MARIO_SPEED;
+    double skip = ceil(((double)distance - lod->nearDistance + speed - 1.0) / closing) - 1.0;
+    uint32_t wait = skip < 1.0 ? 1 : (uint32_t)fmin(skip + 1.0, (double)(UINT32_MAX / 2));
+    if (distance <= lod->midDistance && wait > ENEMY_LOD_MID_INTERVAL) wait = ENEMY_LOD_MID_INTERVAL;
+    return lod->tick + wait;
+}
+
+// Kovalama menzili dışındaki düşman devriye gezer (bkz. ENEMY_CHASE_DISTANCE)
+static void SettleEnemy(EnemySet* enemies, int i, const NavGrid* nav) {
+    enemies->y[i] = nav->groundY - enemies->height[i];
+    enemies->velocityY[i] = 0.0f;
+}
+
+// Her düşman yalnızca statik blokları ve akış alanını okuyup kendi
+// konum/direction/lastTick/wakeTick'ini yazar; grid ve takvim
+// güncellemesi ayrı yapıldığı için aralıklar paralel çalışabilir.
+static void UpdateEnemyRange(EnemySet* enemies, const int* due, const BlockSet* blocks, const SpatialHash* blockGrid, int levelLength,
+    const NavGrid* nav, const EnemyLod* lod, int begin, int end) {
+    for (int k = begin; k < end; k++) {
+        int i = due[k];
+        // Uyuduğu tick'ler kesin devriyedir; önce bu tick'e kadar yetişir
+        uint32_t behind = lod->tick - 1 - enemies->lastTick[i];
+        if (behind > 0) {
+            if (nav != NULL) SettleEnemy(enemies, i, nav);
+            AdvanceEnemyPatrol(enemies, i, behind, blocks, blockGrid, levelLength);
+        }
+        float distance = fabsf(enemies->x[i] + enemies->width[i] / 2 - lod->focusX);
+        if (nav != NULL && distance <= ENEMY_CHASE_DISTANCE) {
+            StepChasingEnemy(enemies, i, blocks, blockGrid, levelLength, nav, lod->focusX);
+        }
+        else {
+            if (nav != NULL) SettleEnemy(enemies, i, nav);
+            StepEnemy(enemies, i, blocks, blockGrid, levelLength);
+        }
+        enemies->lastTick[i] = lod->tick;
+        enemies->wakeTick[i] = NextEnemyWake(enemies, i, lod);
+    }
+}
+
+static int CompareEnemyIds(const void* a, const void* b) {
+    return *(const int*)a - *(const int*)b;
+}
+
+// Bu tick uyanan etkin düşmanları artan indeksle schedule->due'ya yazar.
+// LOD kapalıyken herkes her tick uyanır; çark atlanır ve sonraki açılışta
+// wakeTick'ten yeniden kurulur.
+static void TakeDueEnemies(EnemySet* enemies, EnemySchedule* schedule, const EnemyLod* lod) {
+    WakeWheel* wheel = &schedule->wheel;
+    int count = 0;
+    if (!(lod->nearDistance < INFINITY)) {
+        for (int i = 0; i < enemies->count; i++) {
+            if (GetFlag(enemies->active, i)) schedule->due[count++] = i;
+        }
+        schedule->dueCount = count;
+        schedule->stale = true;
+        return;
+    }
+    if (schedule->stale || wheel->now + 1 != lod->tick) {
+        ClearWakeWheel(wheel, lod->tick - 1);
+        for (int i = 0; i < enemies->count; i++) {
+            if (!GetFlag(enemies->active, i)) continue;
+            uint32_t wake = enemies->wakeTick[i];
+            ScheduleWake(wheel, i, wake > lod->tick ? wake : lod->tick);
+        }
+        schedule->stale = false;
+    }
+    int taken = TakeWakes(wheel, schedule->due);
+    // Ezilen ve boşaltılan yuvalar çarktan uyanınca düşer
+    for (int k = 0; k < taken; k++) {
+        if (GetFlag(enemies->active, schedule->due[k])) schedule->due[count++] = schedule->due[k];
+    }
+    int* due = schedule->due;
+    if (count > 32) {
+        qsort(due, count, sizeof(int), CompareEnemyIds);
+    }
+    else {
+        // Bir tick'te uyananlar çoğunlukla birkaç düşmandır
+        for (int k = 1; k < count; k++) {
+            int id = due[k], j = k;
+            for (; j > 0 && due[j - 1] > id; j--) due[j] = due[j - 1];
+            due[j] = id;
+        }
+    }
+    schedule->dueCount = count;
+}
+
+// Güncellenenler seri yolla aynı sırada taşınır ve yeniden yerleştirilir;
+// grid zincirleri ve dolayısıyla sonraki sorguların sırası paralel yolda
+// da aynı kalır. Uyuyanların grid'deki yeri eskidir, ama odaktan yakın
+// bant kadar uzakta kaldığı için Mario'nun sorgularına girmez.
+static void FinishDueEnemies(EnemySet* enemies, SpatialHash* enemyGrid, EnemySchedule* schedule) {
+    for (int k = 0; k < schedule->dueCount; k++) {
+        int i = schedule->due[k];
+        SpatialHashMove(enemyGrid, i, GetEnemyRect(enemies, i));
+        if (!schedule->stale) ScheduleWake(&schedule->wheel, i, enemies->wakeTick[i]);
+    }
+}
+
+EnemyLod GetEnemyLod(const World* world) {
+    EnemyLod lod;
+    lod.tick = world->tick;
+    lod.focusX = world->marioPosition.x + MARIO_WALK_FRAME_WIDTH / 2;
+    lod.nearDistance = world->enemyLod ? ENEMY_LOD_NEAR : INFINITY;
+    lod.midDistance = world->enemyLod ? ENEMY_LOD_MID : INFINITY;
+    return lod;
+}
+
+void UpdateEnemies(EnemySet* enemies, SpatialHash* enemyGrid, EnemySchedule* schedule, const BlockSet* blocks,
+    const SpatialHash* blockGrid, int levelLength, const NavGrid* nav, const EnemyLod* lod) {
+    TakeDueEnemies(enemies, schedule, lod);
+    UpdateEnemyRange(enemies, schedule->due, blocks, blockGrid, levelLength, nav, lod, 0, schedule->dueCount);
+    FinishDueEnemies(enemies, enemyGrid, schedule);
+}
+
+typedef struct {
+    EnemySet* enemies;
+    const int* due;
+    const BlockSet* blocks;
+    const SpatialHash* blockGrid;
+    int levelLength;
+    const NavGrid* nav;
+    const EnemyLod* lod;
+} EnemyJob;
+
+static void EnemyJobRange(void* data, int begin, int end) {
+    EnemyJob* job = data;
+    UpdateEnemyRange(job->enemies, job->due, job->blocks, job->blockGrid, job->levelLength, job->nav, job->lod, begin, end);
+}
+
+void UpdateEnemiesParallel(JobSystem* jobs, EnemySet* enemies, SpatialHash* enemyGrid, EnemySchedule* schedule, const BlockSet* blocks,
+    const SpatialHash* blockGrid, int levelLength, const NavGrid* nav, const EnemyLod* lod) {
+    TakeDueEnemies(enemies, schedule, lod);
+    EnemyJob job = { enemies, schedule->due, blocks, blockGrid, levelLength, nav, lod };
+    ParallelFor(jobs, schedule->dueCount, ENEMY_JOB_CHUNK, EnemyJobRange, &job);
+    FinishDueEnemies(enemies, enemyGrid, schedule);
+}
+
+void WakeEnemy(World* world, int i) {
+    EnemySchedule* schedule = &world->enemySchedule;
+    world->enemies.wakeTick[i] = world->tick + 1;
+    if (!schedule->stale) ScheduleWake(&schedule->wheel, i, world->tick + 1);
+}
+
+void CatchUpEnemies(World* world) {
+    EnemySet* enemies = &world->enemies;
+    for (int i = 0; i < enemies->count; i++) {
+        if (!GetFlag(enemies->active, i) || enemies->lastTick[i] == world->tick) continue;
+        if (world->nav != NULL) SettleEnemy(enemies, i, world->nav);
+        AdvanceEnemyPatrol(enemies, i, world->tick - enemies->lastTick[i], &world->blocks, &world->blockGrid, world->levelLength);
+        enemies->lastTick[i] = world->tick;
+        SpatialHashMove(&world->enemyGrid, i, GetEnemyRect(enemies, i));
+    }
+}
+
+// Kayıt yoksa ya da doluysa olay düşer
+static void PushWorldEvent(WorldEventLog* events, WorldEventType type, Rectangle rect) {
+    if (events == NULL || events->items == NULL || events->count >= WORLD_EVENT_LOG) return;
+    events->items[events->count++] = (WorldEvent){ type, rect };
+}
+
+// Mario üstten düşerken değdiği ilk bloğa oturur; soru bloğu ilk oturuşta vurulur
+static void ResolveBlockContacts(Vector2* marioPos, Rectangle marioCollider, bool* isJumping, float* velocityY,
+    BlockSet* blocks, const SpatialHash* blockGrid, int* score, WorldEventLog* events) {
+    SpatialQuery query;
+    CandidateBatch batch;
+    uint32_t mask;
+
+    BeginSpatialQuery(blockGrid, marioCollider, &query);
+    while (GatherCandidates(&query, blocks->x, blocks->y, blocks->width, blocks->height, &batch) > 0) {
+        if (CheckCollisionBatch(marioCollider, batch.x, batch.y, batch.width, batch.height, batch.count, &mask) == 0) continue;
+        for (int k = 0; k < batch.count; k++) {
+            int i = batch.ids[k];
+            if (!((mask >> k) & 1u) || blocks->width[i] == 0) continue;
+            if (marioCollider.y + marioCollider.height <= blocks->y[i] + 10 && *velocityY > 0) {
+                marioPos->y = blocks->y[i] - marioCollider.height;
+                *velocityY = 0;
+                *isJumping = false;
+                if (!GetFlag(blocks->stone, i) && !GetFlag(blocks->hit, i)) {
+                    SetFlag(blocks->hit, i, true);
+                    MarkBlockChanged(blocks, GetBlockRect(blocks, i));
+                    PushWorldEvent(events, WORLD_EVENT_BLOCK_HIT, GetBlockRect(blocks, i));
+                    if (GetFlag(blocks->hasCoin, i)) *score += 100;
+                }
+            }
+        }
+    }
+}
+
+// Düşmanı ezdiyse true döner
+static bool ResolveEnemyContacts(Rectangle marioCollider, float* velocityY, EnemySet* enemies, SpatialHash* enemyGrid, int* score,
+    WorldEventLog* events) {
+    SpatialQuery query;
+    CandidateBatch batch;
+    uint32_t mask;
+    bool stomped = false;
+
+    BeginSpatialQuery(enemyGrid, marioCollider, &query);
+    while (GatherCandidates(&query, enemies->x, enemies->y, enemies->width, enemies->height, &batch) > 0) {
+        if (CheckCollisionBatch(marioCollider, batch.x, batch.y, batch.width, batch.height, batch.count, &mask) == 0) continue;
+        for (int k = 0; k < batch.count; k++) {
+            int i = batch.ids[k];
+            if (!((mask >> k) & 1u) || !GetFlag(enemies->active, i)) continue;
+            // Mario düşmanın üstünden geliyorsa (yani zıplama ile)
+            if (marioCollider.y + marioCollider.height - 5 <= enemies->y[i] && *velocityY > 0) {
+                SetFlag(enemies->active, i, false);
+                SpatialHashRemove(enemyGrid, i);
+                PushWorldEvent(events, WORLD_EVENT_ENEMY_STOMPED, GetEnemyRect(enemies, i));
+                *velocityY = -10.0f / 2;
+                *score += 200;
+                stomped = true;
+            }
+            // Mario düşmana yandan veya alttan çarparsa (oyun mantığına göre burada Mario'ya zarar verilebilir)
+        }
+    }
+    return stomped;
+}
+
+static void ResolveCoinContacts(Rectangle marioCollider, CoinSet* coins, SpatialHash* coinGrid, int* score, WorldEventLog* events) {
+    SpatialQuery query;
+    CandidateBatch batch;
+    uint32_t mask;
+
+    BeginSpatialQuery(coinGrid, marioCollider, &query);
+    while (GatherCandidates(&query, coins->x, coins->y, coins->width, coins->height, &batch) > 0) {
+        if (CheckCollisionBatch(marioCollider, batch.x, batch.y, batch.width, batch.height, batch.count, &mask) == 0) continue;
+        for (int k = 0; k < batch.count; k++) {
+            int i = batch.ids[k];
+            if (!((mask >> k) & 1u) || GetFlag(coins->collected, i) || coins->width[i] == 0) continue;
+            SetFlag(coins->collected, i, true);
+            SpatialHashRemove(coinGrid, i);
+            PushWorldEvent(events, WORLD_EVENT_COIN_COLLECTED, GetCoinRect(coins, i));
+            *score += 50;
+        }
+    }
+}
+
+void HandleCollisions(Vector2* marioPos, Rectangle marioCollider, bool* isJumping, float* velocityY,
+    BlockSet* blocks, const SpatialHash* blockGrid, EnemySet* enemies, SpatialHash* enemyGrid, CoinSet* coins, SpatialHash* coinGrid,
+    int* score, int groundY, WorldEventLog* events) {
+    ResolveBlockContacts(marioPos, marioCollider, isJumping, velocityY, blocks, blockGrid, score, events);
+    ResolveEnemyContacts(marioCollider, velocityY, enemies, enemyGrid, score, events);
+    ResolveCoinContacts(marioCollider, coins, coinGrid, score, events);
+}
+
+bool InitWorld(World* world, int groundY, int maxBlocks, int maxEnemies, int maxCoins) {
+    memset(world, 0, sizeof(*world));
+    world->groundY = groundY;
+    world->levelLength = GROUND_LENGTH;
+    world->marioPosition = (Vector2){ MARIO_START_X, groundY - MARIO_BASE_HEIGHT };
+    world->marioDirection = 1;
+    world->enemyLod = true;
+    world->enemySchedule.stale = true;
+
+    world->events.items = malloc(WORLD_EVENT_LOG * sizeof(WorldEvent));
+    world->enemySchedule.due = malloc((maxEnemies > 0 ? maxEnemies : 1) * sizeof(int));
+    if (world->events.items == NULL || world->enemySchedule.due == NULL ||
+        !InitBlockSet(&world->blocks, maxBlocks) ||
+        !InitEnemySet(&world->enemies, maxEnemies) ||
+        !InitCoinSet(&world->coins, maxCoins) ||
+        !InitSpatialHash(&world->blockGrid, maxBlocks) ||
+        !InitSpatialHash(&world->enemyGrid, maxEnemies) ||
+        !InitSpatialHash(&world->coinGrid, maxCoins) ||
+        !InitWakeWheel(&world->enemySchedule.wheel, maxEnemies)) {
+        FreeWorld(world);
+        return false;
+    }
+    return true;
+}
+
+void BuildWorldGrids(World* world) {
+    ClearSpatialHash(&world->blockGrid);
+    ClearSpatialHash(&world->enemyGrid);
+    ClearSpatialHash(&world->coinGrid);
+    for (int i = 0; i < world->blocks.count; i++) {
+        if (world->blocks.width[i] != 0) SpatialHashInsert(&world->blockGrid, i, GetBlockRect(&world->blocks, i));
+    }
+    for (int i = 0; i < world->enemies.count; i++) {
+        if (GetFlag(world->enemies.active, i)) SpatialHashInsert(&world->enemyGrid, i, GetEnemyRect(&world->enemies, i));
+    }
+    for (int i = 0; i < world->coins.count; i++) {
+        if (!GetFlag(world->coins.collected, i) && world->coins.width[i] != 0) SpatialHashInsert(&world->coinGrid, i, GetCoinRect(&world->coins, i));
+    }
+    world->enemySchedule.stale = true;
+}
+
+void FreeWorld(World* world) {
+    FreeBlockSet(&world->blocks);
+    FreeEnemySet(&world->enemies);
+    FreeCoinSet(&world->coins);
+    FreeSpatialHash(&world->blockGrid);
+    FreeSpatialHash(&world->enemyGrid);
+    FreeSpatialHash(&world->coinGrid);
+    FreeWakeWheel(&world->enemySchedule.wheel);
+    free(world->enemySchedule.due);
+    world->enemySchedule.due = NULL;
+    free(world->events.items);
+    world->events = (WorldEventLog){ 0 };
+    if (world->nav != NULL) {
+        FreeNavGrid(world->nav);
+        free(world->nav);
+        world->nav = NULL;
+    }
+}
+
+bool InitWorldNav(World* world, const Rectangle* solids, int solidCount) {
+    NavGrid* nav = malloc(sizeof(NavGrid));
+    if (nav == NULL || !BakeNavGrid(nav, solids, solidCount, world->levelLength, world->groundY)) {
+        free(nav);
+        return false;
+    }
+    if (world->nav != NULL) {
+        FreeNavGrid(world->nav);
+        free(world->nav);
+    }
+    world->nav = nav;
+    return true;
+}
+
+bool InitWorldNavFromBlocks(World* world) {
+    const BlockSet* blocks = &world->blocks;
+    Rectangle* solids = malloc((blocks->count + 1) * sizeof(Rectangle));
+    if (solids == NULL) return false;
+    for (int i = 0; i < blocks->count; i++) solids[i] = GetBlockRect(blocks, i);
+    bool ok = InitWorldNav(world, solids, blocks->count);
+    free(solids);
+    return ok;
+}
+
+// Tek tick'lik yatay adım: sağ önce, sol sonra; parkur sınırında kırpılır
+static float NextMarioX(float x, WorldInput input, float rightLimit, bool* isMoving, int* direction) {
+    if (input.right) {
+        x += MARIO_SPEED;
+        if (x > rightLimit) x = rightLimit;
+        *isMoving = true;
+        *direction = 1;
+    }
+    if (input.left) {
+        if (x > GROUND_START_X) {
+            x -= MARIO_SPEED;
+            if (x < GROUND_START_X) x = GROUND_START_X;
+            *isMoving = true;
+            *direction = -1;
+        }
+    }
+    return x;
+}
+
+static float GetMarioRightLimit(const World* world) {
+    return GROUND_START_X + world->levelLength - MARIO_WALK_FRAME_WIDTH;
+}
+
+// Girdi, yürüme animasyonu, zıplama, yerçekimi ve zemin; çarpışmalardan önceki kısım
+static void MoveMario(World* world, WorldInput input) {
+    bool isMoving = false;
+    Vector2* marioPosition = &world->marioPosition;
+    marioPosition->x = NextMarioX(marioPosition->x, input, GetMarioRightLimit(world), &isMoving, &world->marioDirection);
+
+    if (isMoving && !world->isJumping) {
+        world->walkFrameCounter++;
+        if (world->walkFrameCounter >= WALK_FRAME_SPEED) {
+            world->walkFrameCounter = 0;
+            world->walkFrame++;
+            if (world->walkFrame >= MARIO_WALK_FRAME_COUNT) world->walkFrame = 0;
+        }
+    }
+    else {
+        world->walkFrame = 0;
+        world->walkFrameCounter = 0;
+    }
+    world->isMoving = isMoving;
+
+    if (input.jump && !world->isJumping) {
+        world->velocityY = -MARIO_JUMP_FORCE;
+        world->isJumping = true;
+    }
+
+    world->velocityY += GRAVITY;
+    marioPosition->y += world->velocityY;
+
+    if (marioPosition->y >= world->groundY - MARIO_BASE_HEIGHT) {
+        OturtMarioZemine(marioPosition, world->groundY, MARIO_BASE_HEIGHT);
+        world->isJumping = false;
+        world->velocityY = 0;
+    }
+}
+
+static Rectangle GetMarioCollider(const World* world) {
+    return (Rectangle){ world->marioPosition.x, world->marioPosition.y, MARIO_WALK_FRAME_WIDTH, MARIO_WALK_FRAME_HEIGHT };
+}
+
+static void AdvanceWorldEnemies(World* world) {
+    world->tick++;
+    EnemyLod lod = GetEnemyLod(world);
+    if (world->nav != NULL) {
+        // Mario havadayken altındaki zemine göre; düğüm değişmedikçe alan aynı kalır
+        PROFILE_BEGIN(PROFILE_FLOW_FIELD);
+        UpdateFlowField(world->nav, lod.focusX, world->marioPosition.y + MARIO_BASE_HEIGHT);
+        PROFILE_END(PROFILE_FLOW_FIELD);
+    }
+    PROFILE_BEGIN(PROFILE_ENEMIES);
+    if (world->jobs != NULL && world->enemies.count >= 2 * ENEMY_JOB_CHUNK) {
+        UpdateEnemiesParallel(world->jobs, &world->enemies, &world->enemyGrid, &world->enemySchedule, &world->blocks, &world->blockGrid,
+            world->levelLength, world->nav, &lod);
+    }
+    else {
+        UpdateEnemies(&world->enemies, &world->enemyGrid, &world->enemySchedule, &world->blocks, &world->blockGrid, world->levelLength,
+            world->nav, &lod);
+    }
+    PROFILE_END(PROFILE_ENEMIES);
+}
+
+void StepWorld(World* world, WorldInput input) {
+    MoveMario(world, input);
+    Rectangle marioCollider = GetMarioCollider(world);
+    AdvanceWorldEnemies(world);
+    PROFILE_BEGIN(PROFILE_COLLISIONS);
+    HandleCollisions(&world->marioPosition, marioCollider, &world->isJumping, &world->velocityY,
+        &world->blocks, &world->blockGrid, &world->enemies, &world->enemyGrid, &world->coins, &world->coinGrid,
+        &world->score, world->groundY, &world->events);
+    PROFILE_END(PROFILE_COLLISIONS);
+}
+
+// Çok tick'lik adım. Zıplamasız sabit girdide Mario'nun yörüngesi kapalı
+// biçimdedir: x doğrusal, y tick başına yerçekimiyle
+// y_k = y0 + k * v0 + GRAVITY * k * (k + 1) / 2, yani t'de ikinci derece.
+// Bir pencere boyunca bu yörünge blok ve coin'lere karşı süpürülür
+// (SweepCollision); ilk olası temasa kadar HandleCollisions'ın blok ve
+// coin kısmı hiçbir şey yapmayacağı için atlanır. Düşmanlar hareketli
+// olduğundan yalnızca Mario düşerken (ezme mümkünken) her tick sorgulanır.
+// Bloğun üstünde dururken her tick yarım piksel batıp geri oturma da
+// bloklar değişmediği sürece sorgusuz uygulanır.
+
+#define SWEEP_EPSILON 1e-3
+#define SWEEP_MAX_SEGMENTS 3
+#define SWEEP_MAX_SUPPORTS 32
+
+typedef struct {
+    double start, end;   // Pencere başına göre zaman (tick)
+    Vector2 position;    // start anındaki çarpışma kutusu köşesi
+    Vector2 velocity;
+    Vector2 accel;
+    bool blocksActive;   // Düşüş: bloklara oturma mümkün
+} SweepSegment;
+
+// (entry, exit) açık aralığındaki [first, last] arasındaki ilk tam tick;
+// kayan nokta hatasına karşı aralık genişletilir (erken bulmak zararsız)
+static int FirstTickIn(double entry, double exit, int first, int last) {
+    double k = floor(entry - SWEEP_EPSILON) + 1.0;
+    if (k < first) k = first;
+    if (k > last || k >= exit + SWEEP_EPSILON) return last + 1;
+    return (int)k;
+}
+
+static int FirstSegmentContact(const SweepSegment* segment, Rectangle target, int horizon) {
+    float duration = (float)(segment->end - segment->start);
+    if (duration <= 0.0f) return horizon + 1;
+    Rectangle collider = { segment->position.x, segment->position.y, MARIO_WALK_FRAME_WIDTH, MARIO_WALK_FRAME_HEIGHT };
+    float entry, exit;
+    if (!SweepCollision(collider, segment->velocity, segment->accel, duration, target, &entry, &exit)) return horizon + 1;
+    int first = (int)fmax(1.0, ceil(segment->start - SWEEP_EPSILON));
+    int last = (int)fmin((double)horizon, floor(segment->end + SWEEP_EPSILON));
+    return FirstTickIn(segment->start + entry, segment->start + exit, first, last);
+}
+
+static Rectangle GetSegmentBounds(const SweepSegment* segment) {
+    double t = segment->end - segment->start;
+    float x1 = segment->position.x + (float)(segment->velocity.x * t + 0.5 * segment->accel.x * t * t);
+    float y1 = segment->position.y + (float)(segment->velocity.y * t + 0.5 * segment->accel.y * t * t);
+    float left = fminf(segment->position.x, x1), top = fminf(segment->position.y, y1);
+    return (Rectangle){ left - 1.0f, top - 1.0f, fmaxf(segment->position.x, x1) - left + MARIO_WALK_FRAME_WIDTH + 2.0f,
+        fmaxf(segment->position.y, y1) - top + MARIO_WALK_FRAME_HEIGHT + 2.0f };
+}
+
+static Rectangle MergeRect(Rectangle a, Rectangle b) {
+    float left = fminf(a.x, b.x), top = fminf(a.y, b.y);
+    return (Rectangle){ left, top, fmaxf(a.x + a.width, b.x + b.width) - left, fmaxf(a.y + a.height, b.y + b.height) - top };
+}
+
+// Bloğun üstünde duran Mario için: üst kenarı ayak hizasında olan taş ya
+// da vurulmuş bloklar her tick aynı oturmayı verir. Bunlardan hiçbiri
+// değmeyen ya da başka bir bloğa değilen ilk tick'i döner.
+static int FirstSupportChange(const World* world, const SweepSegment* segment, Rectangle bounds, int horizon) {
+    const BlockSet* blocks = &world->blocks;
+    float supportY = world->marioPosition.y;
+    double supportIn[SWEEP_MAX_SUPPORTS], supportOut[SWEEP_MAX_SUPPORTS];
+    int supportCount = 0;
+    int contact = horizon + 1;
+    Rectangle collider = { segment->position.x, segment->position.y, MARIO_WALK_FRAME_WIDTH, MARIO_WALK_FRAME_HEIGHT };
+
+    SpatialQuery query;
+    BeginSpatialQuery(&world->blockGrid, bounds, &query);
+    int i;
+    while ((i = NextSpatialQuery(&query)) != -1) {
+        if (blocks->width[i] == 0) continue;
+        float entry, exit;
+        if (!SweepCollision(collider, segment->velocity, segment->accel, (float)horizon, GetBlockRect(blocks, i), &entry, &exit)) continue;
+        bool benign = blocks->y[i] - MARIO_WALK_FRAME_HEIGHT == supportY && (GetFlag(blocks->stone, i) || GetFlag(blocks->hit, i));
+        if (!benign || supportCount == SWEEP_MAX_SUPPORTS) {
+            int tick = FirstTickIn(entry, exit, 1, horizon);
+            if (tick < contact) contact = tick;
+            continue;
+        }
+        supportIn[supportCount] = entry;
+        supportOut[supportCount] = exit;
+        supportCount++;
+    }
+
+    // Destekler kesin kapladıkları tick'lerle sayılır (aralık daraltılır)
+    int tick = 1;
+    bool covered = true;
+    while (covered && tick < contact) {
+        covered = false;
+        for (int s = 0; s < supportCount; s++) {
+            if (supportIn[s] + SWEEP_EPSILON < tick && tick < supportOut[s] - SWEEP_EPSILON) {
+                tick = supportOut[s] >= contact ? contact : (int)ceil(supportOut[s] - SWEEP_EPSILON);
+                covered = true;
+            }
+        }
+    }
+    return tick < contact ? tick : contact;
+}
+
+// Girdi sabitken (zıplamasız) HandleCollisions'ın blok ve coin kısmının
+// hiçbir şey yapmayacağı kesin olan tick sayısını döner (en çok maxTicks).
+// *supported, bu tick'lerde Mario'nun bulunduğu bloğa geri oturduğunu bildirir.
+static int PlanSweep(const World* world, WorldInput input, int maxTicks, bool* supported) {
+    *supported = false;
+    float x0 = world->marioPosition.x, y0 = world->marioPosition.y;
+    float rightLimit = GetMarioRightLimit(world);
+    bool isMoving = false;
+    int direction = world->marioDirection;
+    float speedX = NextMarioX(x0, input, rightLimit, &isMoving, &direction) - x0;
+
+    // Yörünge kırpılmadan doğrusal kaldığı sürece
+    int horizon = maxTicks;
+    if (speedX == MARIO_SPEED) horizon = (int)fmin(horizon, floor((rightLimit - x0) / MARIO_SPEED));
+    else if (speedX == -MARIO_SPEED) horizon = (int)fmin(horizon, floor((x0 - GROUND_START_X) / MARIO_SPEED));
+    else if (speedX != 0.0f) horizon = 0;
+    // İki yön birden basılıyken sınırda bir kez kayıp durur; doğrusal değil
+    if (input.left && input.right && speedX != 0.0f) horizon = 0;
+    if (horizon <= 0) return 0;
+
+    SweepSegment segments[SWEEP_MAX_SEGMENTS];
+    int segmentCount = 0;
+    double groundTop = world->groundY - MARIO_BASE_HEIGHT;
+    double v0 = world->velocityY;
+    bool grounded = y0 == groundTop && v0 == 0.0;
+    *supported = !grounded && v0 == 0.0;
+    if (grounded || *supported) {
+        float y = *supported ? y0 + GRAVITY : y0;
+        segments[segmentCount++] = (SweepSegment){ 0.0, horizon, { x0, y }, { speedX, 0.0f }, { 0.0f, 0.0f }, false };
+    }
+    else {
+        // Sürekli yörünge y(t) = y0 + (v0 + g / 2) t + g t^2 / 2 tam tick'lerde birebir tutar
+        double g = GRAVITY;
+        double v = v0 + g / 2.0;
+        double apex = -v / g;
+        double land = (-v + sqrt(v * v + 2.0 * g * (groundTop - y0))) / g;
+        double cuts[SWEEP_MAX_SEGMENTS + 1] = { 0.0, fmin(fmax(apex, 0.0), horizon), fmin(land, horizon), horizon };
+        for (int s = 0; s < SWEEP_MAX_SEGMENTS; s++) {
+            double t = cuts[s];
+            if (cuts[s + 1] <= t) continue;
+            bool onGround = s == 2;
+            Vector2 position = { (float)(x0 + speedX * t), onGround ? (float)groundTop : (float)(y0 + v * t + 0.5 * g * t * t) };
+            Vector2 velocity = { speedX, onGround ? 0.0f : (float)(v + g * t) };
+            Vector2 accel = { 0.0f, onGround ? 0.0f : (float)g };
+            segments[segmentCount++] = (SweepSegment){ t, cuts[s + 1], position, velocity, accel, s == 1 };
+        }
+    }
+
+    Rectangle bounds = GetSegmentBounds(&segments[0]);
+    for (int s = 1; s < segmentCount; s++) bounds = MergeRect(bounds, GetSegmentBounds(&segments[s]));
+
+    int contact = horizon + 1;
+    const CoinSet* coins = &world->coins;
+    SpatialQuery query;
+    BeginSpatialQuery(&world->coinGrid, bounds, &query);
+    int i;
+    while ((i = NextSpatialQuery(&query)) != -1) {
+        if (GetFlag(coins->collected, i) || coins->width[i] == 0) continue;
+        for (int s = 0; s < segmentCount; s++) {
+            int tick = FirstSegmentContact(&segments[s], GetCoinRect(coins, i), horizon);
+            if (tick < contact) contact = tick;
+        }
+    }
+
+    if (*supported) {
+        int tick = FirstSupportChange(world, &segments[0], bounds, horizon);
+        if (tick < contact) contact = tick;
+    }
+    else {
+        const BlockSet* blocks = &world->blocks;
+        BeginSpatialQuery(&world->blockGrid, bounds, &query);
+        while ((i = NextSpatialQuery(&query)) != -1) {
+            if (blocks->width[i] == 0) continue;
+            for (int s = 0; s < segmentCount; s++) {
+                if (!segments[s].blocksActive) continue;
+                int tick = FirstSegmentContact(&segments[s], GetBlockRect(blocks, i), horizon);
+                if (tick < contact) contact = tick;
+            }
+        }
+    }
+    return contact - 1;
+}
+
+void StepWorldTicks(World* world, WorldInput input, int ticks) {
+    if (ticks <= 0) return;
+    StepWorld(world, input);
+    input.jump = false;
+
+    int done = 1;
+    while (done < ticks) {
+        bool supported;
+        PROFILE_BEGIN(PROFILE_COLLISIONS);
+        int sweepTicks = PlanSweep(world, input, (int)fmin(ticks - done, WORLD_SWEEP_MAX_TICKS), &supported);
+        PROFILE_END(PROFILE_COLLISIONS);
+        float supportY = world->marioPosition.y;
+        for (int k = 0; k < sweepTicks; k++) {
+            MoveMario(world, input);
+            Rectangle marioCollider = GetMarioCollider(world);
+            AdvanceWorldEnemies(world);
+            done++;
+            if (supported) {
+                // ResolveBlockContacts'ın aynı bloğa geri oturtması
+                world->marioPosition.y = supportY;
+                world->velocityY = 0;
+                world->isJumping = false;
+            }
+            else if (world->velocityY > 0 &&
+                ResolveEnemyContacts(marioCollider, &world->velocityY, &world->enemies, &world->enemyGrid, &world->score,
+                    &world->events)) {
+                break; // Ezme yörüngeyi değiştirdi; yeniden planlanır
+            }
+        }
+        // Temas tick'i (veya pencere sonu) tam adımla işlenir
+        if (done < ticks) {
+            StepWorld(world, input);
+            done++;
+        }
+    }
+}
@@ -0,0 +1,189 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+// Oyun simülasyon çekirdeği: pencere, ses veya girdi fonksiyonu çağırmaz.
+// raylib.h yalnızca Rectangle/Vector2 tipleri için kullanılır,
+// bu yüzden InitWindow/InitAudioDevice olmadan da çalışır.
+
+#include "raylib.h"
+#include "collide.h"
+#include "entities.h"
+#include "jobs.h"
+#include "spatial.h"
+#include "wakewheel.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define MARIO_WALK_FRAME_COUNT  3
+#define MARIO_WALK_FRAME_WIDTH  25
+#define MARIO_WALK_FRAME_HEIGHT 49
+#define MARIO_JUMP_WIDTH  25
+#define MARIO_JUMP_HEIGHT 49
+#define MARIO_IDLE_WIDTH  25
+#define MARIO_IDLE_HEIGHT 49
+#define MARIO_BASE_HEIGHT MARIO_IDLE_HEIGHT
+
+#define GROUND_START_X 0
+#define GROUND_LENGTH 2000
+#define GROUND_HEIGHT 100
+#define MARIO_START_X (GROUND_START_X + 100)
+
+#define MAX_BLOCKS 50
+#define MAX_ENEMIES 10
+#define MAX_COINS 20
+#define BLOCK_SIZE 64
+#define COIN_SIZE 32
+#define ENEMY_SIZE 48
+
+// Kare başına fizik sabitleri
+#define MARIO_SPEED 5.0f
+#define MARIO_JUMP_FORCE 10.0f
+#define GRAVITY 0.5f
+#define ENEMY_JUMP_FORCE 12.0f // Kovalayan düşmanın zıplaması (navgrid.h NAV_JUMP_HEIGHT)
+#define WALK_FRAME_SPEED 8
+
+// Paralel düşman güncellemesinde iş parçası başına düşman
+#define ENEMY_JOB_CHUNK 512
+
+// Tick'ler arasında tutulan olay sayısı; okuyan taraf boşaltmazsa fazlası düşer
+#define WORLD_EVENT_LOG 64
+
+// StepWorldTicks'in tek süpürmede baktığı en uzun pencere
+#define WORLD_SWEEP_MAX_TICKS 64
+
+// Düşman güncelleme ayrıntı düzeyi: odağa (kameranın takip ettiği Mario'nun
+// ortası) yatay uzaklığa göre yakın bant her tick, orta bant en geç
+// ENEMY_LOD_MID_INTERVAL tick'te bir güncellenir, ötesi uyur. Her düşman,
+// odakla birbirlerine en hızlı yaklaşsalar bile yakın banda giremeyeceği
+// son tick'e kadar uyandırma çarkında bekler (enemies->wakeTick); bir tick
+// yalnızca o tick uyananları ziyaret eder ve grid'de taşır. Aradaki
+// tick'ler kesin devriye olduğundan uyanan düşmanın konumu iki taş duvar
+// arasında analitik olarak ilerletilir ve LOD kapalıyken bulunacağı yerle
+// aynıdır. Sınır, odağın tick başına en çok MARIO_SPEED kaydığını
+// varsayar.
+#define ENEMY_LOD_NEAR (24 * BLOCK_SIZE) // Ekranın yarısı (600px) ve geniş pay; en az ENEMY_CHASE_DISTANCE
+#define ENEMY_LOD_MID (64 * BLOCK_SIZE)
+#define ENEMY_LOD_MID_INTERVAL 4
+
+// Dünyanın gezinme ızgarası varsa odağa bu uzaklığa kadarki düşmanlar
+// devriye yerine Mario'yu kovalar; LOD açık da kapalı da aynıdır. Menzilden
+// çıkan düşman parkur zeminine oturtulur: devriye sabit y'de yürür ve
+// platform kenarlarını bilmez. Menzil ekranın dışında kaldığı için görünmez.
+#define ENEMY_CHASE_DISTANCE (24 * BLOCK_SIZE)
+
+// Bir tick için oyuncu girdisi (IsKeyDown/IsKeyPressed karşılığı)
+typedef struct {
+    bool left;
+    bool right;
+    bool jump;
+} WorldInput;
+
+// Çizim tarafının geri bildirim (efekt, ses) için okuduğu oyun olayları
+typedef enum WorldEventType {
+    WORLD_EVENT_BLOCK_HIT,      // Soru bloğu vuruldu
+    WORLD_EVENT_COIN_COLLECTED,
+    WORLD_EVENT_ENEMY_STOMPED
+} WorldEventType;
+
+typedef struct {
+    WorldEventType type;
+    Rectangle rect; // Olayın olduğu elemanın alanı
+} WorldEvent;
+
+typedef struct {
+    WorldEvent* items; // NULL ise olay tutulmaz
+    int count;         // Okuyan taraf sıfırlar
+} WorldEventLog;
+
+typedef struct NavGrid NavGrid;
+
+typedef struct {
+    uint32_t tick;       // Bu güncellemenin tick numarası
+    float focusX;        // Kovalayan düşmanların hedefi de budur
+    float nearDistance;  // Bu uzaklığa kadar her tick
+    float midDistance;   // Bu uzaklığa kadar seyrek, ötesinde uyur
+} EnemyLod;
+
+// UpdateEnemies'in takvimi: etkin düşmanların wakeTick'inin çarktaki
+// kopyası. Anlık görüntüye girmez; dünya durumu dışarıdan yazıldığında
+// (anlık görüntü, toplu ortam sıfırlama) stale işaretlenir ve sonraki
+// tick wakeTick'ten yeniden kurulur.
+typedef struct {
+    WakeWheel wheel;
+    int* due;      // Bu tick güncellenen düşmanlar, artan indeksle
+    int dueCount;
+    bool stale;
+} EnemySchedule;
+
+typedef struct {
+    Vector2 marioPosition;
+    float velocityY;
+    bool isJumping;
+    bool isMoving;
+    int marioDirection;
+    int walkFrame;
+    int walkFrameCounter;
+    int score;
+    int groundY; // Zeminin üst kenarı
+    int levelLength; // Varsayılan GROUND_LENGTH, akışlı parkurlarda dosyadan gelir
+    uint32_t tick;   // Tamamlanan StepWorld sayısı
+    bool enemyLod;   // false ise tüm düşmanlar her tick güncellenir
+
+    BlockSet blocks;
+    EnemySet enemies;
+    CoinSet coins;
+
+    // Broadphase: yakın hücre sorguları için
+    SpatialHash blockGrid;
+    SpatialHash enemyGrid;
+    SpatialHash coinGrid;
+
+    EnemySchedule enemySchedule;
+
+    WorldEventLog events;
+
+    NavGrid* nav;    // NULL ise düşmanlar yalnızca devriye gezer; InitWorldNav kurar
+
+    JobSystem* jobs; // NULL ise düşmanlar seri güncellenir
+} World;
+
+void OturtMarioZemine(Vector2* marioPos, int groundY, int baseHeight);
+
+void InitLevel(BlockSet* blocks, EnemySet* enemies, CoinSet* coins, int groundY);
+// Dünyanın şu anki tick'i (world->tick) için LOD parametreleri.
+EnemyLod GetEnemyLod(const World* world);
+// lod->tick'te uyanan düşmanları günceller; nav NULL değilse kovalama
+// menzilindekiler akış alanıyla kovalar. Tick'ler sırayla verilmelidir.
+void UpdateEnemies(EnemySet* enemies, SpatialHash* enemyGrid, EnemySchedule* schedule, const BlockSet* blocks,
+    const SpatialHash* blockGrid, int levelLength, const NavGrid* nav, const EnemyLod* lod);
+// UpdateEnemies ile birebir aynı sonucu verir; düşmanlar iş sistemine dağıtılır.
+void UpdateEnemiesParallel(JobSystem* jobs, EnemySet* enemies, SpatialHash* enemyGrid, EnemySchedule* schedule, const BlockSet* blocks,
+    const SpatialHash* blockGrid, int levelLength, const NavGrid* nav, const EnemyLod* lod);
+// Sonradan konan (akışlı parkur) düşmanı sıradaki tick'te uyandırır.
+void WakeEnemy(World* world, int i);
+// Uyuyan düşmanları world->tick'e kadar ilerletir (karşılaştırma için);
+// takvim geçerli kalır.
+void CatchUpEnemies(World* world);
+void HandleCollisions(Vector2* marioPos, Rectangle marioCollider, bool* isJumping, float* velocityY,
+    BlockSet* blocks, const SpatialHash* blockGrid, EnemySet* enemies, SpatialHash* enemyGrid, CoinSet* coins, SpatialHash* coinGrid,
+    int* score, int groundY, WorldEventLog* events);
+
+// Dünyayı boş parkurla kurar; başarısız olursa false döner.
+bool InitWorld(World* world, int groundY, int maxBlocks, int maxEnemies, int maxCoins);
+void FreeWorld(World* world);
+// Parkur dizileri doldurulduktan sonra grid'leri baştan kurar.
+void BuildWorldGrids(World* world);
+// Düşmanların kovalaması için gezinme ızgarasını parkurun tüm katı
+// bloklarından kurar (akışlı parkurda yüklü olmayanlar da verilmeli).
+bool InitWorldNav(World* world, const Rectangle* solids, int solidCount);
+// Parkurun tamamı world->blocks'ta olan (gömülü) dünya için.
+bool InitWorldNavFromBlocks(World* world);
+
+// Tek bir oyun tick'i: Mario hareketi, yerçekimi, düşmanlar ve çarpışmalar.
+void StepWorld(World* world, WorldInput input);
+// ticks kez StepWorld ile birebir aynı sonucu verir; zıplama yalnızca ilk
+// tick'te uygulanır (IsKeyPressed gibi). Mario'nun yolu süpürülerek
+// çarpışmalar çözüldüğü için temas olmayan tick'lerde sorgu yapılmaz.
+void StepWorldTicks(World* world, WorldInput input, int ticks);
+
+#endif